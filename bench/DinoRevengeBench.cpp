@@ -0,0 +1,244 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "DinoRevengeCore.hpp"
+#include "InputReplay.hpp"
+
+// Benchmark sin ventana de 18_DinoRevengeSelect: corre el núcleo de simulación
+// con una entrada guionizada durante N ticks y reporta ticks por segundo, picos
+// de entidades y reservas de memoria hechas durante el juego.
+//
+// Uso: DinoRevengeBench.exe [--ticks N] [--difficulty easy|normal|hard] [--seed S] [--profile]
+//                           [--record archivo.rpl] [--replay archivo.rpl]
+//
+// --profile conecta un FrameProfiler a la simulación para medir su costo.
+// --record guarda la primera partida guionizada como repetición.
+// --replay reproduce una repetición (por ejemplo last_run.rpl del juego) una
+// y otra vez hasta completar N ticks, verificando el checksum final cada vez.
+
+// Contador global de reservas (operator new reemplazado en este binario)
+static std::atomic<std::uint64_t> allocationCount{0};
+static std::atomic<std::uint64_t> allocationBytes{0};
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocationBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+// Tamaños reales de las hojas de sprites en assets/images
+const SheetSize PIKACHU_SHEET = {1344, 768};
+const SheetSize GENGAR_SHEET = {1024, 585};
+const SheetSize CAMIONETA_SHEET = {954, 227};
+const SheetSize MEWTWO_SHEET = {2000, 500};
+const float BACKGROUND_WIDTH = 1000.0f;
+
+// Entrada guionizada: dispara siempre, recorre la pantalla de ida y vuelta,
+// salta cada 0.75s y se agacha de vez en cuando. Solo depende del tick.
+TickInput scriptedInput(std::uint64_t tick) {
+    TickInput input;
+    input.shoot = true;
+    input.left = (tick / 90) % 2 == 1;
+    input.right = !input.left;
+    input.jump = tick % 45 == 0;
+    input.duck = tick % 200 > 180;
+    return input;
+}
+
+struct BenchStats {
+    std::uint64_t ticks = 0;
+    std::uint64_t games = 0;
+    std::uint64_t kills = 0;
+    int bestScore = 0;
+    std::size_t peakEnemies = 0;
+    std::size_t peakProjectiles = 0;
+    std::size_t peakParticles = 0;
+    std::size_t peakEntities = 0;
+};
+
+GameDifficulty parseDifficulty(const char* name) {
+    if (std::strcmp(name, "easy") == 0) return GameDifficulty::EASY;
+    if (std::strcmp(name, "hard") == 0) return GameDifficulty::HARD;
+    return GameDifficulty::NORMAL;
+}
+
+// Reproduce la repetición hasta juntar tickCount ticks; retorna -1 si alguna
+// pasada no termina con el checksum grabado
+int runReplay(const char* path, std::uint64_t tickCount) {
+    std::vector<std::uint8_t> file;
+    if (!readWholeFile(path, file)) {
+        std::printf("No se pudo leer %s\n", path);
+        return -1;
+    }
+    InputReplay replay;
+    if (replay.load(file) != ReplayStatus::OK || replay.getTickCount() == 0) {
+        std::printf("%s no es una repetición válida\n", path);
+        return -1;
+    }
+
+    DinoRevengeSimulation* sim = new DinoRevengeSimulation();
+    std::uint64_t ticks = 0;
+    std::uint64_t passes = 0;
+    std::uint64_t mismatches = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    while (ticks < tickCount) {
+        sim->start(replay.getSetup());
+        replay.rewind();
+        while (!replay.atEnd()) {
+            sim->tick(replay.next());
+        }
+        ticks += replay.getTickCount();
+        ++passes;
+        if (sim->checksum() != replay.getExpectedChecksum() || sim->score != replay.getExpectedScore()) {
+            ++mismatches;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    std::printf("Repetición:       %s (%u ticks, semilla %llu, score %d)\n", path, replay.getTickCount(),
+                static_cast<unsigned long long>(replay.getSetup().seed), replay.getExpectedScore());
+    std::printf("Pasadas:          %llu, %llu con checksum distinto (final %08x, esperado %08x)\n",
+                static_cast<unsigned long long>(passes), static_cast<unsigned long long>(mismatches),
+                sim->checksum(), replay.getExpectedChecksum());
+    std::printf("ns/tick:          %.1f\n", ticks > 0 ? seconds * 1e9 / ticks : 0.0);
+
+    delete sim;
+    return mismatches == 0 ? 0 : -1;
+}
+
+int main(int argc, char** argv) {
+    std::uint64_t tickCount = 1000000;
+    GameDifficulty difficulty = GameDifficulty::NORMAL;
+    std::uint64_t seed = 12345;
+    bool profile = false;
+    const char* recordPath = nullptr;
+    const char* replayPath = nullptr;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            tickCount = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--difficulty") == 0 && i + 1 < argc) {
+            difficulty = parseDifficulty(argv[++i]);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--profile") == 0) {
+            profile = true;
+        } else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            recordPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replayPath = argv[++i];
+        } else {
+            std::printf("Uso: %s [--ticks N] [--difficulty easy|normal|hard] [--seed S] [--profile]"
+                        " [--record archivo.rpl] [--replay archivo.rpl]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (replayPath) {
+        return runReplay(replayPath, tickCount) == 0 ? 0 : 1;
+    }
+
+    RunSetup setup;
+    setup.difficulty = difficulty;
+    setup.playerSheet = PIKACHU_SHEET;
+    setup.playerFrames = 4;
+    setup.enemySheets[0] = GENGAR_SHEET;
+    setup.enemySheets[1] = CAMIONETA_SHEET;
+    setup.enemySheets[2] = MEWTWO_SHEET;
+    setup.backgroundWidth = BACKGROUND_WIDTH;
+    setup.seed = seed;
+
+    // La simulación pesa varios KB de columnas; se crea una sola vez fuera del bucle
+    DinoRevengeSimulation* sim = new DinoRevengeSimulation();
+    sim->start(setup);
+
+    InputRecorder recorder;
+    if (recordPath) {
+        recorder.begin(setup);
+    }
+
+    FrameProfiler* profiler = profile ? new FrameProfiler() : nullptr;
+    sim->profiler = profiler;
+
+    BenchStats stats;
+    std::uint64_t setupAllocations = allocationCount.load();
+    std::uint64_t setupBytes = allocationBytes.load();
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (std::uint64_t tick = 0; tick < tickCount; ++tick) {
+        TickInput input = scriptedInput(tick);
+        recorder.record(input);
+        sim->tick(input);
+        ++stats.ticks;
+
+        stats.peakEnemies = std::max(stats.peakEnemies, sim->enemies.size());
+        stats.peakProjectiles = std::max(stats.peakProjectiles, sim->projectiles.size());
+        stats.peakParticles = std::max(stats.peakParticles, sim->particles.size());
+        stats.peakEntities = std::max(stats.peakEntities, sim->entityCount());
+
+        // Al perder se empieza otra partida, igual que "Reintentar"
+        if (sim->gameOver) {
+            if (recorder.isRecording()) {
+                if (!writeFileAtomic(recordPath, recorder.finish(*sim))) {
+                    std::printf("No se pudo escribir %s\n", recordPath);
+                }
+            }
+            ++stats.games;
+            stats.kills += sim->kills;
+            stats.bestScore = std::max(stats.bestScore, sim->score);
+            sim->reset();
+        }
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    stats.kills += sim->kills;
+    stats.bestScore = std::max(stats.bestScore, sim->score);
+
+    std::uint64_t loopAllocations = allocationCount.load() - setupAllocations;
+    std::uint64_t loopBytes = allocationBytes.load() - setupBytes;
+
+    std::printf("Ticks:            %llu (%.1f s de juego a 60 Hz)\n",
+                static_cast<unsigned long long>(stats.ticks), stats.ticks * FIXED_TIMESTEP);
+    std::printf("Tiempo real:      %.3f s\n", seconds);
+    std::printf("Ticks/seg:        %.0f\n", seconds > 0.0 ? stats.ticks / seconds : 0.0);
+    std::printf("ns/tick:          %.1f\n", stats.ticks > 0 ? seconds * 1e9 / stats.ticks : 0.0);
+    std::printf("Partidas:         %llu terminadas, %llu enemigos eliminados, mejor puntaje %d\n",
+                static_cast<unsigned long long>(stats.games), static_cast<unsigned long long>(stats.kills), stats.bestScore);
+    std::printf("Pico enemigos:    %zu / %zu\n", stats.peakEnemies, MAX_ENEMIES);
+    std::printf("Pico proyectiles: %zu / %zu\n", stats.peakProjectiles, MAX_PROJECTILES);
+    std::printf("Pico partículas:  %zu / %zu\n", stats.peakParticles, MAX_PARTICLES);
+    std::printf("Pico entidades:   %zu\n", stats.peakEntities);
+    std::printf("Reservas setup:   %llu (%llu bytes)\n",
+                static_cast<unsigned long long>(setupAllocations), static_cast<unsigned long long>(setupBytes));
+    std::printf("Reservas en juego: %llu (%llu bytes)\n",
+                static_cast<unsigned long long>(loopAllocations), static_cast<unsigned long long>(loopBytes));
+
+    if (profiler) {
+        std::printf("Eventos medidos:  %zu en el buffer\n", profiler->snapshot(1e9).size());
+    }
+
+    delete profiler;
+    delete sim;
+    return 0;
+}
@@ -0,0 +1,57 @@
+#include <cstdio>
+
+#include "EntityPool.hpp"
+
+// Verificación sin ventana de EntityPool: un handle deja de valer cuando su
+// entidad se destruye o el pool se vacía, aunque el slot se reutilice.
+// Retorna -1 si algún caso falla.
+//
+// Uso: EntityPoolCheck.exe
+
+static int failures = 0;
+
+void check(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("  FALLA: %s\n", what);
+        ++failures;
+    }
+}
+
+// Crear, destruir y volver a crear en el mismo slot
+void destroyAndReuse() {
+    EntityPool<4> pool;
+    EntityHandle old = pool.create();
+    pool.destroyAt(pool.indexOf(old));
+    EntityHandle reused = pool.create();
+    check(reused.slot == old.slot, "destroyAt: el slot se reutiliza");
+    check(!pool.isAlive(old), "destroyAt: el handle viejo no vale");
+    check(pool.isAlive(reused), "destroyAt: el handle nuevo vale");
+}
+
+// Crear, vaciar el pool (como sim.start()) y volver a crear
+void clearAndReuse() {
+    EntityPool<4> pool;
+    EntityHandle first = pool.create();
+    EntityHandle second = pool.create();
+    pool.clear();
+    check(pool.empty(), "clear: el pool queda vacío");
+    check(!pool.isAlive(first) && !pool.isAlive(second), "clear: los handles anteriores no valen");
+
+    EntityHandle reused = pool.create();
+    check(reused.slot == first.slot, "clear: el primer slot se reutiliza");
+    check(!pool.isAlive(first), "clear: el handle anterior no vale para la entidad nueva");
+    check(pool.isAlive(reused), "clear: el handle nuevo vale");
+
+    // Vaciar un pool vacío no invalida nada más
+    pool.clear();
+    pool.clear();
+    EntityHandle again = pool.create();
+    check(pool.isAlive(again) && !pool.isAlive(reused), "clear repetido: solo vale el handle nuevo");
+}
+
+int main() {
+    destroyAndReuse();
+    clearAndReuse();
+    std::printf("EntityPool: %s\n", failures == 0 ? "todos los casos pasan" : "hay casos que fallan");
+    return failures == 0 ? 0 : -1;
+}
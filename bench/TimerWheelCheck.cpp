@@ -0,0 +1,95 @@
+#include <cstdint>
+#include <cstdio>
+
+#include "TimerWheel.hpp"
+
+// Verificación sin ventana de TimerWheel: casos en que fire() modifica la
+// rueda mientras advance() recorre la casilla vencida. Retorna -1 si algún
+// caso falla.
+//
+// Uso: TimerWheelCheck.exe
+
+static int failures = 0;
+
+void check(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("  FALLA: %s\n", what);
+        ++failures;
+    }
+}
+
+// Desde fire() se cancela otro temporizador que vence en el mismo tick
+void cancelSameTick() {
+    TimerWheel wheel(8);
+    TimerHandle handles[3];
+    for (std::uint32_t i = 0; i < 3; ++i) {
+        handles[i] = wheel.schedule(5, 0, i);
+    }
+    int fired[3] = {0, 0, 0};
+    for (int tick = 0; tick < 5; ++tick) {
+        wheel.advance([&](std::uint16_t, std::uint32_t data) {
+            ++fired[data];
+            // El primero que dispare cancela a los otros dos
+            for (TimerHandle& handle : handles) {
+                wheel.cancel(handle);
+            }
+        });
+    }
+    check(fired[0] + fired[1] + fired[2] == 1, "cancelar en el mismo tick: dispara solo uno");
+    check(wheel.size() == 0, "cancelar en el mismo tick: la rueda queda vacía");
+
+    // La lista libre sigue sana: se puede volver a llenar la rueda entera
+    int scheduled = 0;
+    while (wheel.schedule(3, 0).isValid()) {
+        ++scheduled;
+    }
+    check(scheduled == 8, "cancelar en el mismo tick: la capacidad se recupera entera");
+    int later = 0;
+    for (int tick = 0; tick < 3; ++tick) {
+        wheel.advance([&](std::uint16_t, std::uint32_t) { ++later; });
+    }
+    check(later == 8 && wheel.size() == 0, "cancelar en el mismo tick: los reprogramados disparan una vez");
+}
+
+// Desde fire() se reprograma el mismo evento (temporizador repetido)
+void rescheduleFromFire() {
+    TimerWheel wheel(4);
+    wheel.schedule(1, 7);
+    int fired = 0;
+    for (int tick = 0; tick < 200; ++tick) {
+        wheel.advance([&](std::uint16_t event, std::uint32_t) {
+            ++fired;
+            wheel.schedule(2, event);
+        });
+    }
+    check(fired == 100, "reprogramar desde fire: dispara cada 2 ticks");
+    check(wheel.size() == 1, "reprogramar desde fire: queda uno pendiente");
+}
+
+// Temporizadores lejanos que bajan de nivel disparan en su tick exacto
+void cascadeDeadlines() {
+    const std::uint64_t delays[] = {1, 63, 64, 65, 4095, 4096, 5000, 300000};
+    TimerWheel wheel(16);
+    for (std::uint32_t i = 0; i < 8; ++i) {
+        wheel.schedule(delays[i], 0, i);
+    }
+    int wrong = 0;
+    int fired = 0;
+    for (std::uint64_t tick = 0; tick < 300000; ++tick) {
+        wheel.advance([&](std::uint16_t, std::uint32_t data) {
+            ++fired;
+            if (wheel.now() != delays[data]) {
+                ++wrong;
+            }
+        });
+    }
+    check(fired == 8 && wrong == 0, "niveles: cada temporizador dispara en su tick");
+}
+
+int main() {
+    cancelSameTick();
+    rescheduleFromFire();
+    cascadeDeadlines();
+    std::printf("TimerWheel: %s\n", failures == 0 ? "todos los casos pasan" : "hay casos que fallan");
+    return failures == 0 ? 0 : -1;
+}
@@ -0,0 +1,138 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "LossyLink.hpp"
+#include "Random.hpp"
+#include "TronBots.hpp"
+#include "TronRollback.hpp"
+
+// Arnés del modo en red de 08_Tron sin ventana ni sockets: dos sesiones con
+// rollback en el mismo proceso, cada una manejada por un bot, conectadas por
+// dos LossyLink (ida y vuelta) con retardo, variación y pérdida artificiales.
+// El tiempo es simulado (milisegundos virtuales), así que el resultado es
+// reproducible con la misma semilla.
+//
+// Uso: TronNetLoopback.exe [--frames N] [--lag MS] [--jitter MS] [--loss PORCENTAJE] [--size S] [--seed S]
+//
+// Al final compara los checksums de las dos máquinas en el último frame
+// confirmado por ambas: si difieren, las simulaciones se separaron. Retorna -1
+// en ese caso o si alguna sesión detectó una desincronización.
+
+const std::uint32_t FRAME_MS = 30;      // Un tick de 08_Tron
+const std::uint32_t PEER_OFFSET_MS = 13; // Las dos máquinas no tickean a la vez
+
+struct Peer {
+    TronRollbackSession session;
+    TronBot bot;
+    LossyLink outgoing;
+    std::uint64_t nextFrameMs;
+
+    Peer(int size, int player, TronBotKind kind, std::uint32_t lag, std::uint32_t jitter, float loss,
+         std::uint64_t seed, std::uint64_t firstFrameMs)
+        : session(size, player), bot(kind, deriveSeed(seed, 1)), outgoing(lag, jitter, loss, deriveSeed(seed, 2)),
+          nextFrameMs(firstFrameMs) {}
+};
+
+// Un frame de una máquina: recibe lo que llegó, juega con su bot y manda su paquete
+void stepPeer(Peer& peer, LossyLink& incoming, std::uint64_t nowMs) {
+    std::uint8_t packet[LossyLink::MAX_PACKET];
+    while (std::size_t length = incoming.receive(nowMs, packet, sizeof(packet))) {
+        peer.session.readPacket(packet, length);
+    }
+
+    int dirX, dirY;
+    peer.bot.choose(peer.session.getRound(), peer.session.getLocalPlayer(), dirX, dirY);
+    peer.session.advance(dirX, dirY);
+
+    std::size_t length = peer.session.writePacket(packet, sizeof(packet));
+    peer.outgoing.send(packet, length, nowMs);
+}
+
+void printStats(const char* name, const Peer& peer) {
+    const TronNetStats& stats = peer.session.getStats();
+    std::printf("%s frame %u (confirmado %u), ronda %u, puntaje %d-%d\n", name, peer.session.getFrame(),
+                peer.session.getConfirmedFrame(), peer.session.getRoundNumber(), peer.session.getScore(0),
+                peer.session.getScore(1));
+    std::printf("  rollbacks %llu (%.2f frames re-simulados en promedio, máximo %u), esperas %llu\n",
+                static_cast<unsigned long long>(stats.rollbacks),
+                stats.rollbacks > 0 ? static_cast<double>(stats.resimulatedFrames) / stats.rollbacks : 0.0,
+                stats.maxRollback, static_cast<unsigned long long>(stats.stalls));
+    std::printf("  paquetes: %llu enviados (%llu perdidos), %llu recibidos, %llu rechazados\n",
+                static_cast<unsigned long long>(stats.packetsSent),
+                static_cast<unsigned long long>(peer.outgoing.getDroppedCount()),
+                static_cast<unsigned long long>(stats.packetsReceived),
+                static_cast<unsigned long long>(stats.packetsRejected));
+    std::printf("  checksums comparados %llu, distintos %llu\n", static_cast<unsigned long long>(stats.checks),
+                static_cast<unsigned long long>(stats.desyncs));
+}
+
+int main(int argc, char** argv) {
+    std::uint32_t frameCount = 3000;
+    std::uint32_t lag = 60;
+    std::uint32_t jitter = 30;
+    float loss = 0.1f;
+    int size = 40;
+    std::uint64_t seed = 1;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frameCount = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--lag") == 0 && i + 1 < argc) {
+            lag = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--jitter") == 0 && i + 1 < argc) {
+            jitter = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--loss") == 0 && i + 1 < argc) {
+            loss = static_cast<float>(std::atof(argv[++i]) / 100.0);
+        } else if (std::strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            size = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            std::printf("Uso: %s [--frames N] [--lag MS] [--jitter MS] [--loss PORCENTAJE] [--size S] [--seed S]\n",
+                        argv[0]);
+            return -1;
+        }
+    }
+    if (size < 10) size = 10;
+    if (size > 1000) size = 1000;
+
+    Peer red(size, 0, TronBotKind::VORONOI, lag, jitter, loss, deriveSeed(seed, 1), 0);
+    Peer blue(size, 1, TronBotKind::FLOOD_FILL, lag, jitter, loss, deriveSeed(seed, 2), PEER_OFFSET_MS);
+
+    auto start = std::chrono::steady_clock::now();
+    std::uint64_t nowMs = 0;
+    while (red.session.getConfirmedFrame() < frameCount || blue.session.getConfirmedFrame() < frameCount) {
+        if (nowMs >= red.nextFrameMs) {
+            stepPeer(red, blue.outgoing, nowMs);
+            red.nextFrameMs += FRAME_MS;
+        }
+        if (nowMs >= blue.nextFrameMs) {
+            stepPeer(blue, red.outgoing, nowMs);
+            blue.nextFrameMs += FRAME_MS;
+        }
+        ++nowMs;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::uint32_t redChecksum = 0;
+    std::uint32_t blueChecksum = 0;
+    bool compared = red.session.getChecksum(frameCount, redChecksum) && blue.session.getChecksum(frameCount, blueChecksum);
+    bool match = compared && redChecksum == blueChecksum;
+
+    std::printf("Enlace:           %u ms de retardo, +0..%u ms de variación, %.0f%% de pérdida\n", lag, jitter,
+                loss * 100.0f);
+    std::printf("Frames:           %u confirmados en %.1f s simulados (%.3f s reales)\n", frameCount,
+                nowMs / 1000.0, seconds);
+    printStats("Rojo: ", red);
+    printStats("Azul: ", blue);
+    std::printf("Frame %u:        rojo %08x, azul %08x -> %s\n", frameCount, redChecksum, blueChecksum,
+                match ? "iguales" : "DISTINTOS");
+
+    if (!match || red.session.getStats().desyncs > 0 || blue.session.getStats().desyncs > 0) {
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,223 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include "Random.hpp"
+#include "TronBots.hpp"
+#include "TronCore.hpp"
+
+// Torneo sin ventana entre los bots de 08_Tron: juega miles de rondas en
+// paralelo y reporta rondas por segundo y porcentaje de victorias.
+//
+// Uso: TronTournament.exe [--rounds N] [--size S] [--threads T] [--seed S]
+//
+// Cada par ordenado de bots distintos es un cruce; la ronda r juega el cruce
+// r % cantidad de cruces, así cada bot juega de los dos lados. Los hilos toman
+// rondas de un contador compartido y cada uno tiene su propia arena y sus
+// bots, que se reutilizan de ronda en ronda. Cada ronda se siembra con su
+// número, así que el resultado no depende de cuántos hilos se usen.
+
+// Contador global de reservas (operator new reemplazado en este binario)
+static std::atomic<std::uint64_t> allocationCount{0};
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+const int MATCHUPS = TRON_BOT_KINDS * (TRON_BOT_KINDS - 1);
+
+struct Matchup {
+    TronBotKind bots[TRON_PLAYERS];
+};
+
+struct MatchupStats {
+    std::uint64_t rounds = 0;
+    std::uint64_t wins[TRON_PLAYERS] = {0, 0};
+    std::uint64_t draws = 0;
+    std::uint64_t ticks = 0;
+};
+
+struct TournamentStats {
+    MatchupStats matchups[MATCHUPS];
+
+    void add(const TournamentStats& other) {
+        for (int i = 0; i < MATCHUPS; ++i) {
+            matchups[i].rounds += other.matchups[i].rounds;
+            matchups[i].wins[0] += other.matchups[i].wins[0];
+            matchups[i].wins[1] += other.matchups[i].wins[1];
+            matchups[i].draws += other.matchups[i].draws;
+            matchups[i].ticks += other.matchups[i].ticks;
+        }
+    }
+};
+
+void buildMatchups(Matchup matchups[MATCHUPS]) {
+    int count = 0;
+    for (int a = 0; a < TRON_BOT_KINDS; ++a) {
+        for (int b = 0; b < TRON_BOT_KINDS; ++b) {
+            if (a != b) {
+                matchups[count++] = {{static_cast<TronBotKind>(a), static_cast<TronBotKind>(b)}};
+            }
+        }
+    }
+}
+
+// Un hilo del torneo: toma rondas hasta que se acaban y deja el total en out.
+// Acumula en una copia local y escribe out una sola vez al final: los totales
+// de los hilos están uno al lado del otro en memoria y escribirlos en cada
+// ronda haría que los hilos se disputen las mismas líneas de caché.
+void playRounds(std::atomic<std::uint64_t>& nextRound, std::uint64_t roundCount, int size, std::uint64_t seed,
+                const Matchup matchups[MATCHUPS], TournamentStats& out) {
+    TournamentStats stats;
+    TronRound round;
+    TronBot bots[TRON_PLAYERS];
+    Xoshiro128 random;
+
+    for (;;) {
+        std::uint64_t index = nextRound.fetch_add(1, std::memory_order_relaxed);
+        if (index >= roundCount) {
+            break;
+        }
+        int matchup = static_cast<int>(index % MATCHUPS);
+        std::uint64_t roundSeed = deriveSeed(seed, index);
+        random.seed(roundSeed);
+        for (int i = 0; i < TRON_PLAYERS; ++i) {
+            bots[i].setKind(matchups[matchup].bots[i]);
+            bots[i].seed(deriveSeed(roundSeed, static_cast<std::uint64_t>(i + 1)));
+        }
+
+        round.reset(size, size, random);
+        while (!round.isOver()) {
+            for (int i = 0; i < TRON_PLAYERS; ++i) {
+                bots[i].think(round, i);
+            }
+            round.tick();
+        }
+
+        MatchupStats& result = stats.matchups[matchup];
+        ++result.rounds;
+        result.ticks += round.getTickCount();
+        switch (round.getOutcome()) {
+            case TronOutcome::PLAYER1_WINS: ++result.wins[0]; break;
+            case TronOutcome::PLAYER2_WINS: ++result.wins[1]; break;
+            default: ++result.draws; break;
+        }
+    }
+    out = stats;
+}
+
+double percent(std::uint64_t part, std::uint64_t total) {
+    return total > 0 ? 100.0 * part / total : 0.0;
+}
+
+int main(int argc, char** argv) {
+    std::uint64_t roundCount = 1200;
+    int size = 40;
+    int threadCount = static_cast<int>(std::thread::hardware_concurrency());
+    std::uint64_t seed = 1;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--rounds") == 0 && i + 1 < argc) {
+            roundCount = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            size = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threadCount = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            std::printf("Uso: %s [--rounds N] [--size S] [--threads T] [--seed S]\n", argv[0]);
+            return -1;
+        }
+    }
+    size = std::clamp(size, 10, 1000);
+    threadCount = std::max(threadCount, 1);
+
+    Matchup matchups[MATCHUPS];
+    buildMatchups(matchups);
+
+    std::vector<TournamentStats> workerStats(static_cast<std::size_t>(threadCount));
+    std::vector<std::thread> workers;
+    workers.reserve(static_cast<std::size_t>(threadCount));
+    std::atomic<std::uint64_t> nextRound{0};
+
+    std::uint64_t allocationsBefore = allocationCount.load();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < threadCount; ++i) {
+        workers.emplace_back(playRounds, std::ref(nextRound), roundCount, size, seed, matchups,
+                             std::ref(workerStats[static_cast<std::size_t>(i)]));
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::uint64_t allocations = allocationCount.load() - allocationsBefore;
+
+    TournamentStats total;
+    for (const TournamentStats& stats : workerStats) {
+        total.add(stats);
+    }
+
+    std::uint64_t ticks = 0;
+    for (const MatchupStats& matchup : total.matchups) {
+        ticks += matchup.ticks;
+    }
+
+    std::printf("Rondas:           %llu en arena de %dx%d, %d hilos\n", static_cast<unsigned long long>(roundCount),
+                size, size, threadCount);
+    std::printf("Tiempo real:      %.3f s\n", seconds);
+    std::printf("Rondas/seg:       %.0f\n", seconds > 0.0 ? roundCount / seconds : 0.0);
+    std::printf("Ticks por ronda:  %.1f\n", roundCount > 0 ? static_cast<double>(ticks) / roundCount : 0.0);
+    std::printf("Reservas:         %llu (no crecen con las rondas: arena y bots se reutilizan)\n",
+                static_cast<unsigned long long>(allocations));
+
+    std::printf("\nCruce (J1 vs J2)       Rondas   Gana J1   Gana J2   Empates\n");
+    for (int i = 0; i < MATCHUPS; ++i) {
+        const MatchupStats& m = total.matchups[i];
+        char name[32];
+        std::snprintf(name, sizeof(name), "%s vs %s", getTronBotName(matchups[i].bots[0]),
+                      getTronBotName(matchups[i].bots[1]));
+        std::printf("%-22s %7llu   %6.1f%%   %6.1f%%   %6.1f%%\n", name, static_cast<unsigned long long>(m.rounds),
+                    percent(m.wins[0], m.rounds), percent(m.wins[1], m.rounds), percent(m.draws, m.rounds));
+    }
+
+    std::printf("\nBot          Rondas   Victorias   Derrotas   Empates\n");
+    for (int bot = 0; bot < TRON_BOT_KINDS; ++bot) {
+        std::uint64_t played = 0, wins = 0, losses = 0, draws = 0;
+        for (int i = 0; i < MATCHUPS; ++i) {
+            const MatchupStats& m = total.matchups[i];
+            for (int seat = 0; seat < TRON_PLAYERS; ++seat) {
+                if (static_cast<int>(matchups[i].bots[seat]) != bot) {
+                    continue;
+                }
+                played += m.rounds;
+                wins += m.wins[seat];
+                losses += m.wins[1 - seat];
+                draws += m.draws;
+            }
+        }
+        std::printf("%-10s %8llu   %8.1f%%   %7.1f%%   %6.1f%%\n", getTronBotName(static_cast<TronBotKind>(bot)),
+                    static_cast<unsigned long long>(played), percent(wins, played), percent(losses, played),
+                    percent(draws, played));
+    }
+    return 0;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Recorte de cada frame, en fracciones del frame completo (por ejemplo para
+// quitar el margen transparente de una hoja)
+struct ClipCrop {
+    float left = 0.0f;
+    float top = 0.0f;
+    float width = 1.0f;
+    float height = 1.0f;
+};
+
+// Animación de una hoja de sprites con los frames en fila. Los rectángulos
+// (ya recortados), el origen y el tamaño en pantalla se calculan una sola vez
+// al cargar; cada instancia solo guarda qué clip usa y en qué frame va, y
+// dibujar un frame es leer frames[frame].
+struct AnimationClip {
+    std::vector<sf::IntRect> frames;   // En coordenadas de la textura (o de la página del atlas)
+    sf::Vector2f origin;               // Base centrada del frame recortado, en pixeles de textura
+    sf::Vector2f drawSize;             // Tamaño del frame recortado con la escala aplicada
+    float scale = 1.0f;
+    float frameTime = 0.12f;
+    std::size_t page = 0;              // Página del atlas (0 si es una textura suelta)
+
+    std::size_t getFrameCount() const {
+        return frames.size();
+    }
+};
+
+// sheetRect: dónde está la hoja dentro de su textura (la textura completa o la
+// región del atlas)
+inline AnimationClip makeAnimationClip(const sf::IntRect& sheetRect, int frameCount, float frameTime,
+                                       float scale = 1.0f, ClipCrop crop = ClipCrop(), std::size_t page = 0) {
+    AnimationClip clip;
+    int frameWidth = sheetRect.size.x / frameCount;
+    int offsetX = static_cast<int>(frameWidth * crop.left);
+    int offsetY = static_cast<int>(sheetRect.size.y * crop.top);
+    int visibleWidth = static_cast<int>(frameWidth * crop.width);
+    int visibleHeight = static_cast<int>(sheetRect.size.y * crop.height);
+
+    clip.frames.reserve(frameCount);
+    for (int frame = 0; frame < frameCount; ++frame) {
+        clip.frames.push_back(sf::IntRect(sf::Vector2i(sheetRect.position.x + frame * frameWidth + offsetX, sheetRect.position.y + offsetY),
+                                          sf::Vector2i(visibleWidth, visibleHeight)));
+    }
+    clip.origin = sf::Vector2f(visibleWidth / 2.0f, static_cast<float>(visibleHeight));
+    clip.drawSize = sf::Vector2f(visibleWidth * scale, visibleHeight * scale);
+    clip.scale = scale;
+    clip.frameTime = frameTime;
+    clip.page = page;
+    return clip;
+}
+
+typedef std::uint16_t ClipId;
+
+// Todos los clips de un juego, compartidos por todas las instancias que los usan
+class AnimationLibrary {
+public:
+    ClipId add(const AnimationClip& clip) {
+        clips.push_back(clip);
+        return static_cast<ClipId>(clips.size() - 1);
+    }
+
+    const AnimationClip& get(ClipId id) const {
+        return clips[id];
+    }
+
+    std::size_t size() const {
+        return clips.size();
+    }
+
+private:
+    std::vector<AnimationClip> clips;
+};
+
+// Estado de animación de una instancia
+struct AnimationCursor {
+    ClipId clip = 0;
+    std::uint16_t frame = 0;
+    float time = 0.0f;
+
+    // Avanza el tiempo; retorna true si pasó al frame siguiente
+    bool advance(const AnimationClip& data, float deltaTime) {
+        time += deltaTime;
+        if (time < data.frameTime) {
+            return false;
+        }
+        time = 0.0f;
+        frame = static_cast<std::uint16_t>((frame + 1) % data.getFrameCount());
+        return true;
+    }
+};
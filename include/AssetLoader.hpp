@@ -0,0 +1,251 @@
+#pragma once
+
+#include <SFML/Audio.hpp>
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TextureAtlas.hpp"
+
+enum class AssetStatus {
+    LOADING,
+    READY,
+    FAILED
+};
+
+// Handle de un asset pedido a AssetLoader. Se puede copiar libremente; todas
+// las copias ven el mismo estado. Solo se consulta desde el hilo principal.
+template <class Asset>
+class AssetHandle {
+public:
+    AssetStatus getStatus() const {
+        return state ? state->status : AssetStatus::FAILED;
+    }
+
+    bool isLoading() const {
+        return getStatus() == AssetStatus::LOADING;
+    }
+
+    bool isReady() const {
+        return getStatus() == AssetStatus::READY;
+    }
+
+    // nullptr mientras carga o si falló
+    std::shared_ptr<Asset> get() const {
+        return isReady() ? state->asset : nullptr;
+    }
+
+private:
+    friend class AssetLoader;
+
+    struct State {
+        std::shared_ptr<Asset> asset;
+        AssetStatus status = AssetStatus::LOADING;
+    };
+
+    std::shared_ptr<State> state;
+};
+
+// Cargador asíncrono. Un hilo de trabajo lee y decodifica archivos (imágenes,
+// sonidos, cabeceras de música) y empaqueta atlas; lo que necesita la GPU se
+// sube después desde el hilo principal en update(), de a franjas con un
+// presupuesto de bytes por frame para no congelar la pantalla.
+//
+// Uso: pedir los assets de la próxima escena mientras se muestra el menú,
+// llamar update() una vez por frame, y al entrar a la escena usar finish()
+// para completar lo que falte (bloquea solo si el jugador llegó antes).
+class AssetLoader {
+public:
+    // ~1 MB por frame: una textura de 2048 de ancho sube 128 filas por frame
+    static const std::size_t UPLOAD_BYTES_PER_FRAME = 1 << 20;
+
+    AssetLoader() : worker([this] { run(); }) {}
+
+    ~AssetLoader() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wakeUp.notify_one();
+        worker.join();
+    }
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    // Imagen decodificada en segundo plano y subida a la GPU por franjas
+    AssetHandle<sf::Texture> loadTexture(const std::string& path) {
+        auto image = std::make_shared<sf::Image>();
+        auto texture = std::make_shared<sf::Texture>();
+        auto nextRow = std::make_shared<unsigned>(0);
+
+        return addJob<sf::Texture>(texture,
+            [image, path] { return image->loadFromFile(path); },
+            [image, texture, nextRow](std::size_t& byteBudget) {
+                UploadStatus status = uploadImageRows(*texture, *image, *nextRow, byteBudget);
+                if (status != UploadStatus::IN_PROGRESS) {
+                    *image = sf::Image(); // Ya no hace falta la copia en memoria
+                }
+                return status;
+            });
+    }
+
+    // Atlas con todas las hojas: se decodifica y empaqueta en segundo plano y
+    // las páginas se suben por franjas
+    AssetHandle<TextureAtlas> loadAtlas(const std::vector<std::string>& paths) {
+        // El tamaño de página se consulta acá porque necesita contexto de GPU
+        auto atlas = std::make_shared<TextureAtlas>(std::min(2048u, sf::Texture::getMaximumSize()));
+
+        return addJob<TextureAtlas>(atlas,
+            [atlas, paths] {
+                for (const std::string& path : paths) {
+                    if (!atlas->add(path).isValid()) {
+                        return false;
+                    }
+                }
+                return atlas->pack();
+            },
+            [atlas](std::size_t& byteBudget) {
+                return atlas->upload(byteBudget);
+            });
+    }
+
+    // Efecto de sonido decodificado completo en segundo plano
+    AssetHandle<sf::SoundBuffer> loadSoundBuffer(const std::string& path) {
+        auto buffer = std::make_shared<sf::SoundBuffer>();
+        return addJob<sf::SoundBuffer>(buffer, [buffer, path] { return buffer->loadFromFile(path); });
+    }
+
+    // Música en streaming: en segundo plano solo se abre el archivo
+    AssetHandle<sf::Music> openMusic(const std::string& path) {
+        auto music = std::make_shared<sf::Music>();
+        return addJob<sf::Music>(music, [music, path] { return music->openFromFile(path); });
+    }
+
+    // Cualquier otro asset: 'open' corre en el hilo de carga y retorna si tuvo éxito
+    template <class Asset, class Open>
+    AssetHandle<Asset> load(std::shared_ptr<Asset> asset, Open open) {
+        return addJob<Asset>(std::move(asset), std::move(open));
+    }
+
+    // Hilo principal, una vez por frame: termina los trabajos ya decodificados
+    // y sube a la GPU hasta byteBudget bytes
+    void update(std::size_t byteBudget = UPLOAD_BYTES_PER_FRAME) {
+        for (std::size_t i = 0; i < jobs.size();) {
+            Job& job = jobs[i];
+
+            if (job.decoded.valid()) {
+                if (job.decoded.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                    ++i;
+                    continue;
+                }
+                if (!job.decoded.get()) {
+                    job.complete(false);
+                    jobs.erase(jobs.begin() + i);
+                    continue;
+                }
+            }
+
+            UploadStatus status = job.upload ? job.upload(byteBudget) : UploadStatus::DONE;
+            if (status == UploadStatus::IN_PROGRESS) {
+                break; // Se acabó el presupuesto de este frame
+            }
+            job.complete(status == UploadStatus::DONE);
+            jobs.erase(jobs.begin() + i);
+        }
+    }
+
+    // Completa un asset de inmediato, esperando al hilo de carga si hace falta.
+    // Retorna nullptr si la carga falló.
+    template <class Asset>
+    std::shared_ptr<Asset> finish(const AssetHandle<Asset>& handle) {
+        while (handle.isLoading()) {
+            update(~std::size_t(0));
+            if (handle.isLoading()) {
+                waitForNextDecode();
+            }
+        }
+        return handle.get();
+    }
+
+    // Trabajos pedidos que todavía no terminaron
+    std::size_t getPendingCount() const {
+        return jobs.size();
+    }
+
+private:
+    struct Job {
+        std::future<bool> decoded;                               // Parte de CPU (hilo de carga)
+        std::function<UploadStatus(std::size_t&)> upload;        // Parte de GPU (hilo principal), opcional
+        std::function<void(bool)> complete;                      // Publica el resultado en el handle
+    };
+
+    template <class Asset, class Decode>
+    AssetHandle<Asset> addJob(std::shared_ptr<Asset> asset, Decode decode,
+                              std::function<UploadStatus(std::size_t&)> upload = nullptr) {
+        AssetHandle<Asset> handle;
+        handle.state = std::make_shared<typename AssetHandle<Asset>::State>();
+        auto state = handle.state;
+
+        auto task = std::make_shared<std::packaged_task<bool()>>(decode);
+        Job job;
+        job.decoded = task->get_future();
+        job.upload = std::move(upload);
+        job.complete = [state, asset](bool loaded) {
+            state->asset = loaded ? asset : nullptr;
+            state->status = loaded ? AssetStatus::READY : AssetStatus::FAILED;
+        };
+        jobs.push_back(std::move(job));
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.push_back([task] { (*task)(); });
+        }
+        wakeUp.notify_one();
+        return handle;
+    }
+
+    // Bloquea hasta que el próximo trabajo pendiente termine su parte de CPU
+    void waitForNextDecode() {
+        for (Job& job : jobs) {
+            if (job.decoded.valid()) {
+                job.decoded.wait();
+                return;
+            }
+        }
+    }
+
+    void run() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wakeUp.wait(lock, [this] { return stopping || !queue.empty(); });
+                if (stopping) {
+                    return;
+                }
+                task = std::move(queue.front());
+                queue.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::vector<Job> jobs; // Solo hilo principal
+
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::deque<std::function<void()>> queue;
+    bool stopping = false;
+    std::thread worker;
+};
@@ -0,0 +1,666 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "EntityPool.hpp"
+#include "FrameProfiler.hpp"
+#include "GameDifficulty.hpp"
+#include "ParticleSystem.hpp"
+#include "Random.hpp"
+#include "UniformGrid.hpp"
+
+// Núcleo de simulación de 18_DinoRevengeSelect: spawn, movimiento, colisiones
+// y puntaje. No depende de SFML, así que se puede correr sin ventana, sin
+// texturas y sin audio (ver bench/DinoRevengeBench.cpp). El juego solo lee
+// este estado para dibujarlo.
+
+const int WINDOW_WIDTH = 1000;
+const int WINDOW_HEIGHT = 600;
+const int GROUND_HEIGHT = 50;
+const float GRAVITY = 0.4f;
+const float JUMP_STRENGTH = -15.0f;
+
+// Simulación a paso fijo: todas las velocidades están expresadas por tick
+const float FIXED_TIMESTEP = 1.0f / 60.0f;
+const float MAX_FRAME_TIME = 0.25f;      // Evita la espiral de ticks tras un tirón
+
+// Capacidades fijas de los pools de entidades (nunca se reserva memoria al jugar)
+const std::size_t MAX_PROJECTILES = 128;
+const std::size_t MAX_ENEMIES = 32;
+const std::size_t MAX_PARTICLES = 1024; // 51 explosiones simultáneas de 20 partículas
+const float ENEMY_FRAME_TIME = 0.12f;
+const float PLAYER_FRAME_TIME = 0.12f;
+const float PLAYER_SCALE = 0.6f;
+
+// Frames de cada hoja de sprites (todas con los frames en una fila)
+const int PLAYER_FRAME_COUNT = 4;
+const int ENEMY_FRAME_COUNTS[3] = {4, 3, 4}; // Gengar, Camioneta, Mewtwo
+
+// Rejilla de colisiones: celdas de 128px desde x=-128 (los enemigos salen por la izquierda)
+const float COLLISION_CELL_SIZE = 128.0f;
+const int COLLISION_GRID_COLUMNS = 11;
+const int COLLISION_GRID_ROWS = 5;
+
+// Flujos de números aleatorios de la partida (ver deriveSeed en Random.hpp)
+const std::uint64_t RNG_STREAM_SPAWN = 1;
+const std::uint64_t RNG_STREAM_ENEMIES = 2;
+const std::uint64_t RNG_STREAM_PARTICLES = 3;
+
+// Tamaño en pixeles de una hoja de sprites. El núcleo solo necesita las
+// dimensiones para calcular hitboxes; las texturas las carga el juego.
+struct SheetSize {
+    unsigned width;
+    unsigned height;
+};
+
+// Entrada de un tick. El juego la arma con el teclado; el benchmark con un guion.
+struct TickInput {
+    bool left = false;
+    bool right = false;
+    bool jump = false;   // Flanco: se presionó salto desde el tick anterior
+    bool duck = false;   // Agacharse / caída rápida
+    bool shoot = false;
+};
+
+// Estado físico del personaje. El tamaño visible (ya escalado) se calcula a
+// partir de la hoja de sprites con setFrameSize() y define hitbox y cañón.
+class Dino {
+public:
+    float velocityY = 0.0f;
+    float x = 0.0f, y = 0.0f;
+    float previousX = 0.0f, previousY = 0.0f;
+    bool isJumping = false;
+    bool isDucking = false;
+    int animationFrame = 0;
+    int facingDirection = 1;
+    int numFrames = 4;
+    float animationTime = 0.0f;
+    float timeSinceShot = 0.0f;
+    float shootCooldownTime = 0.25f;
+    float width = 0.0f;
+    float height = 0.0f;
+
+    void reset(float startX, float startY, float cooldown) {
+        x = startX;
+        y = startY;
+        previousX = x;
+        previousY = y;
+        velocityY = 0;
+        isJumping = false;
+        isDucking = false;
+        animationFrame = 0;
+        facingDirection = 1;
+        animationTime = 0.0f;
+        timeSinceShot = 0.0f;
+        shootCooldownTime = cooldown;
+    }
+
+    // Recorte del sprite: 80% del ancho de un frame y 60% del alto de la hoja
+    void setSheet(SheetSize sheet, int frames) {
+        numFrames = frames;
+        int frameWidth = sheet.width / frames;
+        width = static_cast<int>(frameWidth * 0.8f) * PLAYER_SCALE;
+        height = static_cast<int>(sheet.height * 0.6f) * PLAYER_SCALE;
+    }
+
+    // Se llama al inicio de cada tick, antes de mover al personaje
+    void savePreviousPosition() {
+        previousX = x;
+        previousY = y;
+    }
+
+    void jump() {
+        if (!isJumping && !isDucking) {
+            velocityY = JUMP_STRENGTH;
+            isJumping = true;
+        }
+    }
+
+    void duck(bool shouldDuck) {
+        if (!isJumping) {
+            isDucking = shouldDuck;
+        }
+    }
+
+    void moveLeft() {
+        x -= 8.0f;
+        if (x < 50) x = 50;
+        facingDirection = -1;
+    }
+
+    void moveRight() {
+        x += 8.0f;
+        if (x > WINDOW_WIDTH - 50) x = WINDOW_WIDTH - 50;
+        facingDirection = 1;
+    }
+
+    void update(float groundY, bool fastFall, float deltaTime) {
+        if (isJumping) {
+            if (fastFall) {
+                velocityY += GRAVITY * 4.0f; // Caída más rápida al presionar abajo/S
+            } else {
+                velocityY += GRAVITY;
+            }
+            y += velocityY;
+
+            if (y >= groundY) {
+                y = groundY;
+                velocityY = 0;
+                isJumping = false;
+            }
+        }
+
+        animationTime += deltaTime;
+        if (animationTime > PLAYER_FRAME_TIME && !isJumping) {
+            animationFrame = (animationFrame + 1) % numFrames;
+            animationTime = 0.0f;
+        }
+
+        timeSinceShot += deltaTime;
+    }
+
+    bool canShoot() const {
+        return timeSinceShot > shootCooldownTime;
+    }
+
+    void resetShootClock() {
+        timeSinceShot = 0.0f;
+    }
+
+    // Hitbox: 60% del ancho y 70% del alto visibles, centrada en el sprite
+    Aabb getBounds() const {
+        float newWidth = width * 0.6f;
+        float newHeight = height * 0.7f;
+        float left = x - width / 2.0f + (width - newWidth) / 2.0f;
+        float top = y - height + (height - newHeight) / 2.0f;
+        return Aabb::fromRect(left, top, newWidth, newHeight);
+    }
+
+    float getShootX() const {
+        return facingDirection == 1 ? x + (width * 0.4f) : x - (width * 0.4f);
+    }
+
+    float getShootY() const {
+        return y - (height * 0.5f);
+    }
+};
+
+// Proyectiles en columnas (SoA): posiciones, velocidades, hitbox y banderas
+// viven en arreglos contiguos.
+class ProjectilePool {
+public:
+    EntityPool<MAX_PROJECTILES> pool;
+    std::array<float, MAX_PROJECTILES> previousX;
+    std::array<float, MAX_PROJECTILES> x;
+    std::array<float, MAX_PROJECTILES> y;
+    std::array<float, MAX_PROJECTILES> velocityX;
+    std::array<Aabb, MAX_PROJECTILES> bounds;
+    std::array<bool, MAX_PROJECTILES> active;
+
+    std::size_t size() const {
+        return pool.size();
+    }
+
+    void clear() {
+        pool.clear();
+    }
+
+    // Si el pool está lleno el disparo se descarta (retorna un handle inválido)
+    EntityHandle spawn(float startX, float startY, int direction) {
+        EntityHandle handle = pool.create();
+        if (!handle.isValid()) {
+            return handle;
+        }
+
+        std::size_t i = pool.size() - 1;
+        x[i] = startX;
+        previousX[i] = startX;
+        y[i] = startY;
+        velocityX[i] = 15.0f * direction;
+        active[i] = true;
+        updateBounds(i);
+        return handle;
+    }
+
+    void update() {
+        for (std::size_t i = 0; i < pool.size(); ++i) {
+            previousX[i] = x[i];
+            x[i] += velocityX[i];
+            updateBounds(i);
+
+            if (x[i] > WINDOW_WIDTH + 20 || x[i] < -20 || y[i] > WINDOW_HEIGHT) {
+                active[i] = false;
+            }
+        }
+    }
+
+    // Compacta las columnas quitando los proyectiles inactivos
+    void removeInactive() {
+        for (std::size_t i = pool.size(); i-- > 0;) {
+            if (!active[i]) {
+                std::size_t from = pool.destroyAt(i);
+                moveColumns(from, i, previousX, x, y, velocityX, bounds, active);
+            }
+        }
+    }
+
+private:
+    // Equivale a shape.getGlobalBounds(): radio 6 más 2px de contorno
+    void updateBounds(std::size_t i) {
+        bounds[i] = Aabb::fromRect(x[i] - 2, y[i] - 2, 16, 16);
+    }
+};
+
+// Datos compartidos por todos los enemigos de un mismo tipo
+struct EnemyType {
+    int numFrames;
+    int frameWidth;
+    int frameHeight;
+    float scale;
+    float y;
+};
+
+// Enemigos en columnas. La entidad no carga con sprite ni reloj: solo datos.
+class EnemyPool {
+public:
+    EntityPool<MAX_ENEMIES> pool;
+    std::array<float, MAX_ENEMIES> previousX;
+    std::array<float, MAX_ENEMIES> x;
+    std::array<float, MAX_ENEMIES> y;
+    std::array<float, MAX_ENEMIES> speed;
+    std::array<float, MAX_ENEMIES> animTime;
+    std::array<Aabb, MAX_ENEMIES> bounds;
+    std::array<std::uint8_t, MAX_ENEMIES> type; // 0=Gengar, 1=Camioneta, 2=Mewtwo
+    std::array<std::uint8_t, MAX_ENEMIES> currentFrame;
+    std::array<bool, MAX_ENEMIES> active;
+
+    std::vector<EnemyType> types;
+    Xoshiro128 random; // Velocidad de cada enemigo nuevo
+
+    // Registra un tipo de enemigo a partir del tamaño de su hoja de sprites;
+    // se llama al cargar, nunca durante el juego
+    void addType(SheetSize sheet, int frames, float targetHeight, float groundY) {
+        EnemyType info;
+        info.numFrames = frames;
+        info.frameWidth = sheet.width / frames;
+        info.frameHeight = sheet.height;
+        info.scale = targetHeight / sheet.height;
+        info.y = groundY;
+        types.push_back(info);
+    }
+
+    std::size_t size() const {
+        return pool.size();
+    }
+
+    void clear() {
+        pool.clear();
+    }
+
+    EntityHandle spawn(float startX, int enemyType) {
+        EntityHandle handle = pool.create();
+        if (!handle.isValid()) {
+            return handle;
+        }
+
+        std::size_t i = pool.size() - 1;
+        x[i] = startX;
+        previousX[i] = startX;
+        y[i] = types[enemyType].y;
+        speed[i] = 3.0f + random.nextInt(3) * 0.5f;
+        animTime[i] = 0.0f;
+        type[i] = static_cast<std::uint8_t>(enemyType);
+        currentFrame[i] = 0;
+        active[i] = true;
+        updateBounds(i);
+        return handle;
+    }
+
+    void update(float speedMultiplier, float deltaTime) {
+        for (std::size_t i = 0; i < pool.size(); ++i) {
+            previousX[i] = x[i];
+            x[i] -= speed[i] * speedMultiplier;
+            updateBounds(i);
+
+            // Animar sprite
+            animTime[i] += deltaTime;
+            if (animTime[i] > ENEMY_FRAME_TIME) {
+                currentFrame[i] = static_cast<std::uint8_t>((currentFrame[i] + 1) % types[type[i]].numFrames);
+                animTime[i] = 0.0f;
+            }
+
+            if (x[i] < -100) {
+                active[i] = false;
+            }
+        }
+    }
+
+    void removeInactive() {
+        for (std::size_t i = pool.size(); i-- > 0;) {
+            if (!active[i]) {
+                std::size_t from = pool.destroyAt(i);
+                moveColumns(from, i, previousX, x, y, speed, animTime, bounds, type, currentFrame, active);
+            }
+        }
+    }
+
+private:
+    // Equivale a sprite.getGlobalBounds() con el origen en la base central
+    void updateBounds(std::size_t i) {
+        const EnemyType& info = types[type[i]];
+        float width = info.frameWidth * info.scale;
+        float height = info.frameHeight * info.scale;
+        bounds[i] = Aabb::fromRect(x[i] - width / 2.0f, y[i] - height, width, height);
+    }
+};
+
+// Todo lo que define una partida antes del primer tick. Con la misma
+// configuración y las mismas entradas, la simulación repite exactamente la
+// misma partida (ver InputReplay.hpp).
+struct RunSetup {
+    GameDifficulty difficulty = GameDifficulty::NORMAL;
+    std::uint8_t character = 0;        // Índice del personaje elegido (solo lo usa el frontend)
+    SheetSize playerSheet = {0, 0};
+    std::uint8_t playerFrames = 4;
+    SheetSize enemySheets[3] = {};     // Gengar, Camioneta, Mewtwo
+    float backgroundWidth = WINDOW_WIDTH;
+    std::uint64_t seed = 0;
+};
+
+// Estado completo de una partida. tick() avanza FIXED_TIMESTEP segundos.
+class DinoRevengeSimulation {
+public:
+    Dino dino;
+    EnemyPool enemies;
+    ProjectilePool projectiles;
+    ParticleSystem<MAX_PARTICLES> particles;
+    UniformGrid<MAX_ENEMIES, COLLISION_GRID_COLUMNS, COLLISION_GRID_ROWS> enemyGrid;
+
+    DifficultyModifiers modifiers = getDifficultyModifiers(GameDifficulty::NORMAL);
+
+    // Calcular posición del suelo - personajes tocan el borde del suelo
+    float groundY = WINDOW_HEIGHT - GROUND_HEIGHT;
+    // Ajustar posición del personaje más abajo
+    float playerGroundY = groundY + 70;
+
+    float backgroundWidth = WINDOW_WIDTH;
+    float backgroundX = 0.0f;
+    float previousBackgroundX = 0.0f;
+    float backgroundSpeed = 2.0f;
+    float gameSpeedMultiplier = 1.0f;
+
+    float spawnTimer = 0.0f;
+    float spawnInterval = 2.0f;
+    int lastEnemyType = -1;    // -1=ninguno, 0=Gengar, 1=Camioneta, 2=Mewtwo
+    int consecutiveTrucks = 0; // Contador de camionetas consecutivas
+
+    int score = 0;
+    int lives = 3;
+    int kills = 0;
+    bool gameOver = false;
+    std::uint64_t tickCount = 0;
+    int shotsFired = 0; // Disparos aún no consumidos por el frontend (sonido)
+    FrameProfiler* profiler = nullptr; // Opcional: mide spawn, update, colisiones y limpieza
+    Xoshiro128 spawnRandom;            // Tipo de cada enemigo nuevo
+
+    DinoRevengeSimulation()
+        : enemyGrid(-COLLISION_CELL_SIZE, 0.0f, COLLISION_CELL_SIZE) {}
+
+    void setDifficulty(GameDifficulty difficulty) {
+        modifiers = getDifficultyModifiers(difficulty);
+    }
+
+    // Cada subsistema recibe su propio generador derivado de la semilla
+    void setSeed(std::uint64_t seed) {
+        spawnRandom.seed(deriveSeed(seed, RNG_STREAM_SPAWN));
+        enemies.random.seed(deriveSeed(seed, RNG_STREAM_ENEMIES));
+        particles.random.seed(deriveSeed(seed, RNG_STREAM_PARTICLES));
+    }
+
+    // Configura personaje, enemigos, dificultad y semilla, y reinicia
+    void start(const RunSetup& setup) {
+        setDifficulty(setup.difficulty);
+        dino.setSheet(setup.playerSheet, setup.playerFrames);
+        setEnemySheets(setup.enemySheets[0], setup.enemySheets[1], setup.enemySheets[2]);
+        backgroundWidth = setup.backgroundWidth;
+        setSeed(setup.seed);
+        reset();
+    }
+
+    // Tipos de enemigo: altura objetivo y posición Y de la base de cada uno
+    void setEnemySheets(SheetSize gengar, SheetSize camioneta, SheetSize mewtwo) {
+        enemies.types.clear();
+        enemies.addType(gengar, ENEMY_FRAME_COUNTS[0], 180.0f, 600.0f);    // Gengar - más grande y mucho más abajo
+        enemies.addType(camioneta, ENEMY_FRAME_COUNTS[1], 140.0f, 595.0f); // Camioneta - más abajo
+        enemies.addType(mewtwo, ENEMY_FRAME_COUNTS[2], 150.0f, 590.0f);    // Mewtwo
+    }
+
+    // Reinicia la partida con el mismo personaje y dificultad
+    void reset() {
+        dino.reset(100, playerGroundY, modifiers.shootCooldown);
+        enemies.clear();
+        projectiles.clear();
+        particles.clear();
+        enemyGrid.clear();
+        backgroundX = 0.0f;
+        previousBackgroundX = 0.0f;
+        gameSpeedMultiplier = modifiers.speedMultiplier;
+        spawnTimer = 0.0f;
+        spawnInterval = 2.0f;
+        lastEnemyType = -1;
+        consecutiveTrucks = 0;
+        score = 0;
+        lives = 3;
+        kills = 0;
+        gameOver = false;
+        tickCount = 0;
+        shotsFired = 0;
+    }
+
+    std::size_t entityCount() const {
+        return enemies.size() + projectiles.size() + particles.size();
+    }
+
+    // Huella del estado de juego (FNV-1a). Dos simulaciones con la misma
+    // semilla y las mismas entradas deben dar el mismo valor en cada tick;
+    // sirve para validar repeticiones y detectar desincronizaciones.
+    std::uint32_t checksum() const {
+        std::uint32_t hash = 2166136261u;
+        auto mix = [&hash](std::uint32_t value) {
+            for (int b = 0; b < 4; ++b) {
+                hash = (hash ^ ((value >> (b * 8)) & 0xFF)) * 16777619u;
+            }
+        };
+        auto mixFloat = [&mix](float value) {
+            std::uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            mix(bits);
+        };
+
+        mix(static_cast<std::uint32_t>(tickCount));
+        mix(static_cast<std::uint32_t>(score));
+        mix(static_cast<std::uint32_t>(lives));
+        mix(static_cast<std::uint32_t>(kills));
+        mix(gameOver ? 1u : 0u);
+        mixFloat(dino.x);
+        mixFloat(dino.y);
+        mixFloat(backgroundX);
+        mix(static_cast<std::uint32_t>(enemies.size()));
+        for (std::size_t i = 0; i < enemies.size(); ++i) {
+            mixFloat(enemies.x[i]);
+            mix(enemies.type[i]);
+        }
+        mix(static_cast<std::uint32_t>(projectiles.size()));
+        for (std::size_t i = 0; i < projectiles.size(); ++i) {
+            mixFloat(projectiles.x[i]);
+        }
+        mix(static_cast<std::uint32_t>(particles.size()));
+        return hash;
+    }
+
+    void tick(const TickInput& input) {
+        if (gameOver) {
+            return;
+        }
+
+        ++tickCount;
+        {
+            ProfileScope updateScope(profiler, ProfilePhase::UPDATE);
+            updatePlayer(input);
+        }
+
+        {
+            ProfileScope spawnScope(profiler, ProfilePhase::SPAWN);
+            spawnEnemies();
+        }
+
+        {
+            // Actualizar entidades con velocidad aumentada
+            ProfileScope updateScope(profiler, ProfilePhase::UPDATE);
+            enemies.update(gameSpeedMultiplier, FIXED_TIMESTEP);
+            projectiles.update();
+            particles.update(FIXED_TIMESTEP);
+        }
+
+        {
+            ProfileScope collisionScope(profiler, ProfilePhase::COLLISION);
+            resolveCollisions();
+        }
+
+        {
+            // Limpiar objetos inactivos (compacta las columnas, sin mover objetos pesados)
+            ProfileScope cleanupScope(profiler, ProfilePhase::CLEANUP);
+            enemies.removeInactive();
+            projectiles.removeInactive();
+        }
+    }
+
+private:
+    // Personaje, velocidad del juego y fondo
+    void updatePlayer(const TickInput& input) {
+        dino.savePreviousPosition();
+        previousBackgroundX = backgroundX;
+
+        if (input.jump) {
+            dino.jump();
+        }
+
+        // Movimiento horizontal
+        if (input.left) {
+            dino.moveLeft();
+        }
+        if (input.right) {
+            dino.moveRight();
+        }
+
+        // Control de agacharse y caída rápida
+        dino.duck(input.duck);
+
+        // Disparar proyectiles
+        if (input.shoot && dino.canShoot()) {
+            projectiles.spawn(dino.getShootX(), dino.getShootY(), dino.facingDirection);
+            dino.resetShootClock();
+            ++shotsFired;
+        }
+
+        // Actualizar personaje con su posición de suelo ajustada y caída rápida si presiona abajo/S
+        dino.update(playerGroundY, input.duck, FIXED_TIMESTEP);
+
+        // La velocidad aumenta gradualmente pero respeta el multiplicador base de dificultad
+        float progressMultiplier = 1.0f + (score / 100.0f);
+        if (progressMultiplier > 2.0f) progressMultiplier = 2.0f; // Límite máximo de 2x
+        gameSpeedMultiplier = modifiers.speedMultiplier * progressMultiplier;
+
+        // Mover fondo con velocidad aumentada
+        backgroundX -= backgroundSpeed * gameSpeedMultiplier;
+
+        // Al completar un ancho se regresa (también el valor previo, para no interpolar el salto)
+        if (backgroundX <= -backgroundWidth) {
+            backgroundX += backgroundWidth;
+            previousBackgroundX += backgroundWidth;
+        }
+    }
+
+    // Spawn enemigos - seleccionar aleatoriamente entre Gengar, Camioneta y Mewtwo
+    void spawnEnemies() {
+        float currentSpawnInterval = spawnInterval;
+
+        // Si el último enemigo fue una camioneta, usar intervalo más largo
+        if (lastEnemyType == 1) {
+            currentSpawnInterval = std::max(3.5f, spawnInterval * 1.8f); // Mínimo 3.5 segundos después de una camioneta
+        }
+
+        spawnTimer += FIXED_TIMESTEP;
+        if (spawnTimer <= (currentSpawnInterval / gameSpeedMultiplier)) {
+            return;
+        }
+
+        int randomEnemy = static_cast<int>(spawnRandom.nextInt(3)); // 0=Gengar, 1=Camioneta, 2=Mewtwo
+
+        // Si el último enemigo fue una camioneta, evitar generar otra camioneta
+        // (75% de probabilidad de evitarla, 25% de permitirla)
+        if (lastEnemyType == 1 && randomEnemy == 1 && spawnRandom.nextInt(100) < 75) {
+            randomEnemy = (spawnRandom.nextInt(2) == 0) ? 0 : 2; // Gengar o Mewtwo en su lugar
+        }
+
+        // Limitar camionetas consecutivas a máximo 1
+        if (randomEnemy == 1 && consecutiveTrucks >= 1) {
+            randomEnemy = (spawnRandom.nextInt(2) == 0) ? 0 : 2; // Forzar Gengar o Mewtwo
+        }
+
+        enemies.spawn(WINDOW_WIDTH, randomEnemy);
+        spawnTimer = 0.0f;
+
+        // Actualizar contador de camionetas consecutivas
+        if (randomEnemy == 1) {
+            consecutiveTrucks++;
+        } else {
+            consecutiveTrucks = 0;
+        }
+
+        lastEnemyType = randomEnemy;
+
+        if (score > 0 && score % 10 == 0 && spawnInterval > 1.2f) {
+            spawnInterval -= 0.05f; // Reducción más gradual, mínimo 1.2s
+        }
+    }
+
+    void resolveCollisions() {
+        enemyGrid.rebuild(enemies.bounds.data(), enemies.size());
+
+        // Colisiones proyectiles-enemigos (solo pares candidatos de la rejilla)
+        enemyGrid.forEachPair(projectiles.bounds.data(), projectiles.size(), [&](std::size_t p, std::size_t e) {
+            if (!projectiles.active[p]) {
+                return false;
+            }
+            // La camioneta (tipo 1) es inmune a las balas - las balas la traspasan
+            if (!enemies.active[e] || enemies.type[e] == 1) {
+                return true; // La bala no se destruye y sigue buscando otro enemigo
+            }
+            projectiles.active[p] = false;
+            enemies.active[e] = false;
+            score += static_cast<int>(10 * modifiers.scoreMultiplier);
+            ++kills;
+            particles.emit(DINO_REVENGE_EXPLOSION, enemies.x[e], enemies.y[e] - 25);
+            return false;
+        });
+
+        // Colisiones dino-enemigos
+        enemyGrid.query(dino.getBounds(), [&](std::uint16_t e) {
+            if (enemies.active[e]) {
+                enemies.active[e] = false;
+                lives--;
+                if (lives <= 0) {
+                    gameOver = true;
+                }
+            }
+            return true;
+        });
+    }
+};
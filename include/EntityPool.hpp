@@ -0,0 +1,166 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Caja alineada a los ejes. Se usa en lugar de sf::FloatRect para que los datos
+// de simulación no dependan de SFML y se puedan guardar en arreglos contiguos.
+struct Aabb {
+    float left = 0.0f;
+    float top = 0.0f;
+    float right = 0.0f;
+    float bottom = 0.0f;
+
+    static Aabb fromRect(float x, float y, float width, float height) {
+        return Aabb{x, y, x + width, y + height};
+    }
+
+    bool intersects(const Aabb& other) const {
+        return left < other.right && other.left < right &&
+               top < other.bottom && other.top < bottom;
+    }
+};
+
+// Handle generacional: índice del slot más su generación. Cuando un slot se
+// recicla la generación aumenta, así que un handle viejo deja de ser válido.
+struct EntityHandle {
+    static constexpr std::uint16_t INVALID_SLOT = 0xFFFF;
+
+    std::uint16_t slot = INVALID_SLOT;
+    std::uint16_t generation = 0;
+
+    bool isValid() const {
+        return slot != INVALID_SLOT;
+    }
+
+    bool operator==(const EntityHandle& other) const {
+        return slot == other.slot && generation == other.generation;
+    }
+
+    bool operator!=(const EntityHandle& other) const {
+        return !(*this == other);
+    }
+};
+
+// Pool de capacidad fija que reparte handles generacionales y mantiene las
+// entidades vivas empaquetadas en las posiciones [0, size()). Los datos de cada
+// entidad viven en columnas (std::array) del dueño del pool, indexadas por la
+// posición densa; así los bucles de actualización recorren memoria contigua.
+//
+// Crear o destruir nunca reserva memoria: la lista libre es una pila de slots y
+// al destruir se mueve el último elemento denso al hueco.
+template <std::size_t Capacity>
+class EntityPool {
+    static_assert(Capacity > 0 && Capacity < EntityHandle::INVALID_SLOT,
+                  "La capacidad debe caber en un indice de 16 bits");
+
+public:
+    EntityPool() {
+        generations.fill(0);
+        slotToDense.fill(EntityHandle::INVALID_SLOT);
+        denseToSlot.fill(EntityHandle::INVALID_SLOT);
+        count = 0;
+        clear();
+    }
+
+    // Libera todas las entidades. La generación de cada slot vivo aumenta,
+    // igual que en destroyAt(), así que los handles emitidos antes del clear()
+    // no valen para las entidades que se creen después en esos slots.
+    void clear() {
+        for (std::size_t d = 0; d < count; ++d) {
+            ++generations[denseToSlot[d]];
+        }
+        count = 0;
+        freeCount = Capacity;
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            // Se apilan al revés para que el primer slot en salir sea el 0
+            freeList[i] = static_cast<std::uint16_t>(Capacity - 1 - i);
+            slotToDense[i] = EntityHandle::INVALID_SLOT;
+        }
+    }
+
+    static constexpr std::size_t capacity() {
+        return Capacity;
+    }
+
+    std::size_t size() const {
+        return count;
+    }
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    bool full() const {
+        return freeCount == 0;
+    }
+
+    // Reserva un slot. La nueva entidad ocupa la posición densa size() - 1.
+    // Si el pool está lleno retorna un handle inválido.
+    EntityHandle create() {
+        if (freeCount == 0) {
+            return EntityHandle{};
+        }
+
+        std::uint16_t slot = freeList[--freeCount];
+        std::uint16_t dense = static_cast<std::uint16_t>(count++);
+        slotToDense[slot] = dense;
+        denseToSlot[dense] = slot;
+
+        return EntityHandle{slot, generations[slot]};
+    }
+
+    bool isAlive(EntityHandle handle) const {
+        return handle.slot < Capacity &&
+               generations[handle.slot] == handle.generation &&
+               slotToDense[handle.slot] != EntityHandle::INVALID_SLOT;
+    }
+
+    // Posición densa de un handle vivo (usar isAlive() antes).
+    std::size_t indexOf(EntityHandle handle) const {
+        return slotToDense[handle.slot];
+    }
+
+    EntityHandle handleAt(std::size_t index) const {
+        std::uint16_t slot = denseToSlot[index];
+        return EntityHandle{slot, generations[slot]};
+    }
+
+    // Destruye la entidad en la posición densa 'index'. El último elemento se
+    // mueve a 'index'; se retorna su posición original para que el dueño copie
+    // sus columnas (si el valor retornado es igual a 'index' no hay nada que mover).
+    std::size_t destroyAt(std::size_t index) {
+        std::size_t last = --count;
+        std::uint16_t slot = denseToSlot[index];
+
+        if (index != last) {
+            std::uint16_t movedSlot = denseToSlot[last];
+            denseToSlot[index] = movedSlot;
+            slotToDense[movedSlot] = static_cast<std::uint16_t>(index);
+        }
+
+        slotToDense[slot] = EntityHandle::INVALID_SLOT;
+        ++generations[slot];
+        freeList[freeCount++] = slot;
+
+        return last;
+    }
+
+private:
+    std::array<std::uint16_t, Capacity> generations;
+    std::array<std::uint16_t, Capacity> slotToDense;
+    std::array<std::uint16_t, Capacity> denseToSlot;
+    std::array<std::uint16_t, Capacity> freeList;
+    std::size_t freeCount = 0;
+    std::size_t count = 0;
+};
+
+// Copia el elemento 'from' sobre 'to' en todas las columnas recibidas. Se usa
+// junto con EntityPool::destroyAt() para compactar las columnas de un pool.
+template <class... Columns>
+inline void moveColumns(std::size_t from, std::size_t to, Columns&... columns) {
+    if (from != to) {
+        ((columns[to] = columns[from]), ...);
+    }
+}
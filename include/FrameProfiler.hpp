@@ -0,0 +1,256 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Fases medidas en cada frame. FRAME es el frame completo.
+enum class ProfilePhase : std::uint8_t {
+    FRAME,
+    INPUT,
+    SPAWN,
+    UPDATE,
+    COLLISION,
+    CLEANUP,
+    DRAW
+};
+
+const std::size_t PROFILE_PHASE_COUNT = 7;
+
+inline const char* getProfilePhaseName(ProfilePhase phase) {
+    switch (phase) {
+        case ProfilePhase::FRAME:
+            return "frame";
+        case ProfilePhase::INPUT:
+            return "input";
+        case ProfilePhase::SPAWN:
+            return "spawn";
+        case ProfilePhase::UPDATE:
+            return "update";
+        case ProfilePhase::COLLISION:
+            return "collision";
+        case ProfilePhase::CLEANUP:
+            return "cleanup";
+        default:
+            return "draw";
+    }
+}
+
+// Un intervalo medido. drawCalls y entities solo se llenan en los eventos FRAME.
+struct ProfileEvent {
+    ProfilePhase phase;
+    std::uint32_t thread;
+    std::int64_t startNs;       // Desde la creación del profiler
+    std::int64_t durationNs;
+    std::uint32_t drawCalls;
+    std::uint32_t entities;
+};
+
+// Resumen de un frame para el overlay
+struct FrameStats {
+    std::int64_t phaseNs[PROFILE_PHASE_COUNT] = {};
+    std::uint32_t drawCalls = 0;
+    std::uint32_t entities = 0;
+};
+
+// Profiler de frames sin SFML (lo usa también el núcleo de simulación).
+//
+// Cada medición se guarda en un ring buffer de tamaño fijo: registrar es un
+// fetch_add y unas escrituras atómicas, sin locks ni memoria nueva, y puede
+// hacerse desde cualquier hilo. Cada casilla lleva un número de secuencia
+// (seqlock) para que exportar la traza descarte las que se estaban pisando
+// mientras se leían. Además, el hilo que creó el profiler acumula el tiempo
+// de cada fase del frame actual y guarda los últimos HISTORY_FRAMES frames
+// para el overlay.
+class FrameProfiler {
+public:
+    static const std::size_t EVENT_CAPACITY = 1 << 15;   // ~20 s a 144 FPS con ~10 eventos por frame
+    static const std::size_t HISTORY_FRAMES = 240;
+
+    FrameProfiler()
+        : slots(EVENT_CAPACITY), origin(std::chrono::steady_clock::now()),
+          ownerThread(std::this_thread::get_id()) {}
+
+    FrameProfiler(const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+
+    std::int64_t now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin).count();
+    }
+
+    void record(ProfilePhase phase, std::int64_t startNs, std::int64_t endNs,
+                std::uint32_t drawCalls = 0, std::uint32_t entities = 0) {
+        std::uint64_t index = head.fetch_add(1, std::memory_order_relaxed);
+        Slot& slot = slots[index & (EVENT_CAPACITY - 1)];
+
+        slot.sequence.store(index * 2 + 1, std::memory_order_relaxed); // Impar: escribiendo
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.phase.store(static_cast<std::uint8_t>(phase), std::memory_order_relaxed);
+        slot.thread.store(currentThreadId(), std::memory_order_relaxed);
+        slot.startNs.store(startNs, std::memory_order_relaxed);
+        slot.durationNs.store(endNs - startNs, std::memory_order_relaxed);
+        slot.drawCalls.store(drawCalls, std::memory_order_relaxed);
+        slot.entities.store(entities, std::memory_order_relaxed);
+        slot.sequence.store(index * 2 + 2, std::memory_order_release);
+
+        if (phase != ProfilePhase::FRAME && std::this_thread::get_id() == ownerThread) {
+            currentFrame.phaseNs[static_cast<std::size_t>(phase)] += endNs - startNs;
+        }
+    }
+
+    void beginFrame() {
+        frameStartNs = now();
+        currentFrame = FrameStats();
+    }
+
+    void endFrame(std::size_t drawCalls, std::size_t entities) {
+        std::int64_t endNs = now();
+        currentFrame.phaseNs[static_cast<std::size_t>(ProfilePhase::FRAME)] = endNs - frameStartNs;
+        currentFrame.drawCalls = static_cast<std::uint32_t>(drawCalls);
+        currentFrame.entities = static_cast<std::uint32_t>(entities);
+        record(ProfilePhase::FRAME, frameStartNs, endNs, currentFrame.drawCalls, currentFrame.entities);
+
+        history[frameCount % HISTORY_FRAMES] = currentFrame;
+        ++frameCount;
+    }
+
+    // Frames guardados en el historial (como máximo HISTORY_FRAMES)
+    std::size_t getHistorySize() const {
+        return static_cast<std::size_t>(std::min<std::uint64_t>(frameCount, HISTORY_FRAMES));
+    }
+
+    // framesAgo = 0 es el último frame terminado
+    const FrameStats& getFrame(std::size_t framesAgo) const {
+        return history[(frameCount - 1 - framesAgo) % HISTORY_FRAMES];
+    }
+
+    std::uint64_t getFrameCount() const {
+        return frameCount;
+    }
+
+    // Eventos completos de los últimos 'seconds' segundos, del más viejo al más nuevo
+    std::vector<ProfileEvent> snapshot(double seconds) const {
+        std::int64_t sinceNs = now() - static_cast<std::int64_t>(seconds * 1e9);
+        std::uint64_t end = head.load(std::memory_order_acquire);
+        std::uint64_t begin = end > EVENT_CAPACITY ? end - EVENT_CAPACITY : 0;
+
+        std::vector<ProfileEvent> events;
+        events.reserve(static_cast<std::size_t>(end - begin));
+        for (std::uint64_t index = begin; index < end; ++index) {
+            const Slot& slot = slots[index & (EVENT_CAPACITY - 1)];
+            std::uint64_t before = slot.sequence.load(std::memory_order_acquire);
+            if (before != index * 2 + 2) {
+                continue; // Todavía escribiéndose o ya pisado por uno más nuevo
+            }
+            ProfileEvent event;
+            event.phase = static_cast<ProfilePhase>(slot.phase.load(std::memory_order_relaxed));
+            event.thread = slot.thread.load(std::memory_order_relaxed);
+            event.startNs = slot.startNs.load(std::memory_order_relaxed);
+            event.durationNs = slot.durationNs.load(std::memory_order_relaxed);
+            event.drawCalls = slot.drawCalls.load(std::memory_order_relaxed);
+            event.entities = slot.entities.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != before) {
+                continue;
+            }
+            if (event.startNs >= sinceNs) {
+                events.push_back(event);
+            }
+        }
+        return events;
+    }
+
+    // Traza en formato trace_event de Chrome (abrir en chrome://tracing o
+    // ui.perfetto.dev). Los frames llevan draw calls y entidades como argumentos
+    // y además como contadores.
+    std::string exportChromeTrace(double seconds) const {
+        std::vector<ProfileEvent> events = snapshot(seconds);
+
+        std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        char line[256];
+        std::snprintf(line, sizeof(line),
+                      "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"principal\"}}",
+                      threadIdOf(ownerThread));
+        json += line;
+
+        for (const ProfileEvent& event : events) {
+            double ts = event.startNs / 1000.0;
+            std::snprintf(line, sizeof(line),
+                          ",\n{\"name\":\"%s\",\"cat\":\"game\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f",
+                          getProfilePhaseName(event.phase), event.thread, ts, event.durationNs / 1000.0);
+            json += line;
+            if (event.phase == ProfilePhase::FRAME) {
+                std::snprintf(line, sizeof(line),
+                              ",\"args\":{\"drawCalls\":%u,\"entities\":%u}}"
+                              ",\n{\"name\":\"counts\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"drawCalls\":%u,\"entities\":%u}}",
+                              event.drawCalls, event.entities, ts, event.drawCalls, event.entities);
+                json += line;
+            } else {
+                json += "}";
+            }
+        }
+        json += "\n]}\n";
+        return json;
+    }
+
+private:
+    struct Slot {
+        std::atomic<std::uint64_t> sequence{0};
+        std::atomic<std::uint8_t> phase{0};
+        std::atomic<std::uint32_t> thread{0};
+        std::atomic<std::int64_t> startNs{0};
+        std::atomic<std::int64_t> durationNs{0};
+        std::atomic<std::uint32_t> drawCalls{0};
+        std::atomic<std::uint32_t> entities{0};
+    };
+
+    static std::uint32_t threadIdOf(std::thread::id id) {
+        return static_cast<std::uint32_t>(std::hash<std::thread::id>()(id) & 0x7FFFFFFF);
+    }
+
+    static std::uint32_t currentThreadId() {
+        thread_local std::uint32_t id = threadIdOf(std::this_thread::get_id());
+        return id;
+    }
+
+    std::vector<Slot> slots;
+    std::atomic<std::uint64_t> head{0};
+    std::chrono::steady_clock::time_point origin;
+    std::thread::id ownerThread;
+
+    // Solo los usa el hilo dueño
+    std::int64_t frameStartNs = 0;
+    FrameStats currentFrame;
+    std::array<FrameStats, HISTORY_FRAMES> history{};
+    std::uint64_t frameCount = 0;
+};
+
+// Mide el bloque en el que vive. Con profiler nulo no hace nada, así el
+// núcleo puede correr sin medir (por ejemplo en el benchmark).
+class ProfileScope {
+public:
+    ProfileScope(FrameProfiler* profiler, ProfilePhase phase)
+        : profiler(profiler), phase(phase), startNs(profiler ? profiler->now() : 0) {}
+
+    ~ProfileScope() {
+        if (profiler) {
+            profiler->record(phase, startNs, profiler->now());
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    FrameProfiler* profiler;
+    ProfilePhase phase;
+    std::int64_t startNs;
+};
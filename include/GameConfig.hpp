@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "GameDifficulty.hpp"
+#include "Leaderboard.hpp"
+
+// Configuración y récords compartidos por los juegos con menú
+// (18_DinoRevengeSelect y 28_MenuSystem). Implementación en lib/GameConfig.cpp.
+
+// Récords: una tabla de los 10 mejores por dificultad
+const std::size_t HIGH_SCORES_PER_DIFFICULTY = 10;
+using HighScoreTables = LeaderboardSet<GameDifficulty, GAME_DIFFICULTY_COUNT, HIGH_SCORES_PER_DIFFICULTY>;
+
+// Estructura de configuración global
+struct GameConfig {
+    float musicVolume = 50.0f;   // Volumen de música de fondo
+    float sfxVolume = 50.0f;     // Volumen de efectos de sonido
+    HighScoreTables highScores;  // Récords por dificultad
+};
+
+// Archivo de configuración binario (ver SaveFile.hpp).
+// Versión 1: volúmenes y una lista de récords. Versión 2: una tabla por dificultad.
+const char* const CONFIG_PATH = "game_config.dat";
+const std::uint16_t CONFIG_VERSION = 2;
+
+// Guardar no bloquea: el archivo se escribe en segundo plano y de forma atómica
+void saveConfig(const GameConfig& config);
+
+// Lee el archivo binario (o el de texto de versiones anteriores). Si no existe
+// o está dañado, config queda con los valores que tenía.
+void loadConfig(GameConfig& config);
+
+// Inserta en la tabla de su dificultad (búsqueda binaria, sin reordenar) y
+// guarda solo si entró
+void addHighScore(GameConfig& config, const std::string& playerName, int score, GameDifficulty difficulty);
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <string>
+
+// Dificultad elegida en el menú. Lo usan la simulación (DinoRevengeCore.hpp),
+// la configuración y las tablas de récords; no depende de SFML.
+enum class GameDifficulty {
+    EASY,      // Todo más lento, menor multiplicador de score
+    NORMAL,    // Velocidad base, multiplicador estándar
+    HARD       // Todo más rápido + cooldown en disparos, mayor multiplicador
+};
+
+const int GAME_DIFFICULTY_COUNT = 3;
+
+// Multiplicadores según dificultad
+struct DifficultyModifiers {
+    float speedMultiplier;
+    float scoreMultiplier;
+    float shootCooldown;
+};
+
+inline DifficultyModifiers getDifficultyModifiers(GameDifficulty difficulty) {
+    DifficultyModifiers mods;
+
+    switch (difficulty) {
+        case GameDifficulty::EASY:
+            mods.speedMultiplier = 0.7f;   // 70% de velocidad
+            mods.scoreMultiplier = 0.5f;   // 50% de puntos
+            mods.shootCooldown = 0.25f;
+            break;
+
+        case GameDifficulty::NORMAL:
+            mods.speedMultiplier = 1.0f;   // 100% de velocidad
+            mods.scoreMultiplier = 1.0f;   // 100% de puntos
+            mods.shootCooldown = 0.25f;
+            break;
+
+        case GameDifficulty::HARD:
+        default:
+            mods.speedMultiplier = 1.4f;   // 140% de velocidad
+            mods.scoreMultiplier = 1.5f;   // 150% de puntos
+            mods.shootCooldown = 0.5f;     // Doble cooldown en disparos
+            break;
+    }
+
+    return mods;
+}
+
+// Nombre de cada dificultad tal como se muestra (y como se guardaba en el formato de texto)
+inline const char* getDifficultyName(GameDifficulty difficulty) {
+    switch (difficulty) {
+        case GameDifficulty::EASY:
+            return "Facil";
+        case GameDifficulty::HARD:
+            return "Dificil";
+        default:
+            return "Normal";
+    }
+}
+
+inline GameDifficulty parseDifficultyName(const std::string& name) {
+    if (name == "Facil") return GameDifficulty::EASY;
+    if (name == "Dificil") return GameDifficulty::HARD;
+    return GameDifficulty::NORMAL;
+}
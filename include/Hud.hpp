@@ -0,0 +1,247 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// HUD de campos numéricos ("Score: 120", "Lives: 3"...). Al armarlo, las
+// etiquetas fijas y los dígitos 0-9 de cada tamaño de letra se dibujan una sola
+// vez en una RenderTexture (en blanco; el color va en los vértices). Después
+// cada campo es una tira fija de quads dentro de un solo VertexArray:
+// setValue() solo marca el campo como sucio si el número cambió, y draw()
+// re-arma únicamente los campos sucios. Actualizar un número no reserva
+// memoria ni vuelve a maquetar texto, y todo el HUD es una sola llamada de dibujo.
+class Hud {
+public:
+    static const std::size_t MAX_DIGITS = 11;                   // Signo y 10 dígitos de un int
+    static const std::size_t QUADS_PER_FIELD = MAX_DIGITS + 2;  // Prefijo + número + sufijo
+
+    // Agrega un campo antes de build(). prefix y suffix se dibujan alrededor del número.
+    int addField(sf::Vector2f position, unsigned characterSize, sf::Color color,
+                 const sf::String& prefix, const sf::String& suffix = "") {
+        Field field;
+        field.position = sf::Vector2f(std::round(position.x), std::round(position.y));
+        field.characterSize = characterSize;
+        field.color = color;
+        field.prefix = prefix;
+        field.suffix = suffix;
+        fields.push_back(field);
+        return static_cast<int>(fields.size() - 1);
+    }
+
+    // Hornea etiquetas y dígitos con la fuente dada. Retorna false si no se
+    // pudo crear la textura.
+    bool build(const sf::Font& font) {
+        // Una tira de dígitos por tamaño de letra
+        for (Field& field : fields) {
+            field.digitSet = findDigitSet(field.characterSize);
+            if (field.digitSet == digitSets.size()) {
+                DigitSet set;
+                set.characterSize = field.characterSize;
+                digitSets.push_back(set);
+            }
+        }
+
+        // Ubicar cada pieza en filas dentro de la textura
+        std::vector<Piece> pieces;
+        for (std::size_t s = 0; s < digitSets.size(); ++s) {
+            for (std::size_t d = 0; d < DIGIT_CHARS; ++d) {
+                pieces.push_back(Piece{sf::String(DIGITS[d]), digitSets[s].characterSize, &digitSets[s].digits[d]});
+            }
+        }
+        for (Field& field : fields) {
+            if (!field.prefix.isEmpty()) {
+                pieces.push_back(Piece{field.prefix, field.characterSize, &field.prefixRect});
+            }
+            if (!field.suffix.isEmpty()) {
+                pieces.push_back(Piece{field.suffix, field.characterSize, &field.suffixRect});
+            }
+        }
+
+        unsigned x = 0, y = 0, rowHeight = 0;
+        for (Piece& piece : pieces) {
+            sf::Text text(font, piece.string, piece.characterSize);
+            unsigned width = static_cast<unsigned>(std::ceil(text.findCharacterPos(piece.string.getSize()).x)) + GLYPH_MARGIN;
+            unsigned height = static_cast<unsigned>(std::ceil(font.getLineSpacing(piece.characterSize)));
+            if (x + width > TEXTURE_WIDTH) {
+                x = 0;
+                y += rowHeight;
+                rowHeight = 0;
+            }
+            *piece.rect = sf::IntRect(sf::Vector2i(x, y), sf::Vector2i(width, height));
+            x += width;
+            rowHeight = std::max(rowHeight, height);
+        }
+
+        if (!texture.resize(sf::Vector2u(TEXTURE_WIDTH, std::max(1u, y + rowHeight)))) {
+            return false;
+        }
+        texture.clear(sf::Color::Transparent);
+        for (const Piece& piece : pieces) {
+            sf::Text text(font, piece.string, piece.characterSize);
+            text.setFillColor(sf::Color::White);
+            text.setPosition(sf::Vector2f(piece.rect->position));
+            texture.draw(text);
+        }
+        texture.display();
+
+        // El avance de cada dígito (sin el margen) es lo que mueve la pluma
+        for (DigitSet& set : digitSets) {
+            for (std::size_t d = 0; d < DIGIT_CHARS; ++d) {
+                set.advance[d] = set.digits[d].size.x - static_cast<int>(GLYPH_MARGIN);
+            }
+        }
+
+        vertices.setPrimitiveType(sf::PrimitiveType::Triangles);
+        vertices.resize(fields.size() * QUADS_PER_FIELD * 6);
+        for (Field& field : fields) {
+            field.dirty = true;
+        }
+        return true;
+    }
+
+    // Cambia el número de un campo; si es el mismo no hace nada
+    void setValue(int index, int value) {
+        Field& field = fields[index];
+        if (field.hasValue && field.value == value) {
+            return;
+        }
+        field.value = value;
+        field.hasValue = true;
+        field.dirty = true;
+    }
+
+    void draw(sf::RenderTarget& target) {
+        for (std::size_t i = 0; i < fields.size(); ++i) {
+            if (fields[i].dirty) {
+                layoutField(i);
+            }
+        }
+        target.draw(vertices, sf::RenderStates(&texture.getTexture()));
+    }
+
+    // Cantidad de veces que se re-armó un campo (para medir)
+    std::size_t getLayoutCount() const {
+        return layoutCount;
+    }
+
+private:
+    static const unsigned TEXTURE_WIDTH = 512;
+    static const unsigned GLYPH_MARGIN = 2;     // Para que el filtrado no mezcle piezas vecinas
+    static const std::size_t DIGIT_CHARS = 11;  // 0-9 y el signo menos
+    static constexpr const char* DIGITS[DIGIT_CHARS] = {"0", "1", "2", "3", "4", "5", "6", "7", "8", "9", "-"};
+
+    struct DigitSet {
+        unsigned characterSize = 0;
+        std::array<sf::IntRect, DIGIT_CHARS> digits;
+        std::array<int, DIGIT_CHARS> advance{};
+    };
+
+    struct Field {
+        sf::Vector2f position;
+        unsigned characterSize = 0;
+        sf::Color color;
+        sf::String prefix;
+        sf::String suffix;
+        sf::IntRect prefixRect;
+        sf::IntRect suffixRect;
+        std::size_t digitSet = 0;
+        int value = 0;
+        bool hasValue = false;
+        bool dirty = true;
+    };
+
+    struct Piece {
+        sf::String string;
+        unsigned characterSize;
+        sf::IntRect* rect;
+    };
+
+    std::size_t findDigitSet(unsigned characterSize) const {
+        for (std::size_t s = 0; s < digitSets.size(); ++s) {
+            if (digitSets[s].characterSize == characterSize) {
+                return s;
+            }
+        }
+        return digitSets.size();
+    }
+
+    void layoutField(std::size_t index) {
+        Field& field = fields[index];
+        const DigitSet& set = digitSets[field.digitSet];
+        std::size_t quad = index * QUADS_PER_FIELD;
+        std::size_t lastQuad = quad + QUADS_PER_FIELD;
+        float penX = field.position.x;
+
+        if (field.prefixRect.size.x > 0) {
+            setQuad(quad++, sf::Vector2f(penX, field.position.y), field.prefixRect, field.color);
+            penX += field.prefixRect.size.x - static_cast<float>(GLYPH_MARGIN);
+        }
+
+        if (field.hasValue) {
+            // Dígitos de derecha a izquierda en un buffer fijo
+            std::array<std::size_t, MAX_DIGITS> chars;
+            std::size_t count = 0;
+            long long value = field.value;
+            bool negative = value < 0;
+            if (negative) value = -value;
+            do {
+                chars[count++] = static_cast<std::size_t>(value % 10);
+                value /= 10;
+            } while (value > 0 && count < MAX_DIGITS);
+            if (negative && count < MAX_DIGITS) {
+                chars[count++] = DIGIT_CHARS - 1;
+            }
+
+            for (std::size_t i = count; i-- > 0;) {
+                std::size_t digit = chars[i];
+                setQuad(quad++, sf::Vector2f(penX, field.position.y), set.digits[digit], field.color);
+                penX += set.advance[digit];
+            }
+        }
+
+        if (field.suffixRect.size.x > 0) {
+            setQuad(quad++, sf::Vector2f(penX, field.position.y), field.suffixRect, field.color);
+        }
+
+        // Los quads que sobran quedan degenerados (no dibujan nada)
+        for (; quad < lastQuad; ++quad) {
+            for (std::size_t v = 0; v < 6; ++v) {
+                vertices[quad * 6 + v] = sf::Vertex{sf::Vector2f(), sf::Color::Transparent, sf::Vector2f()};
+            }
+        }
+
+        field.dirty = false;
+        ++layoutCount;
+    }
+
+    void setQuad(std::size_t quad, sf::Vector2f position, const sf::IntRect& rect, sf::Color color) {
+        float left = static_cast<float>(rect.position.x);
+        float top = static_cast<float>(rect.position.y);
+        float right = left + rect.size.x;
+        float bottom = top + rect.size.y;
+        sf::Vector2f size(static_cast<float>(rect.size.x), static_cast<float>(rect.size.y));
+
+        sf::Vertex topLeft{position, color, sf::Vector2f(left, top)};
+        sf::Vertex topRight{sf::Vector2f(position.x + size.x, position.y), color, sf::Vector2f(right, top)};
+        sf::Vertex bottomRight{position + size, color, sf::Vector2f(right, bottom)};
+        sf::Vertex bottomLeft{sf::Vector2f(position.x, position.y + size.y), color, sf::Vector2f(left, bottom)};
+
+        std::size_t v = quad * 6;
+        vertices[v + 0] = topLeft;
+        vertices[v + 1] = topRight;
+        vertices[v + 2] = bottomRight;
+        vertices[v + 3] = topLeft;
+        vertices[v + 4] = bottomRight;
+        vertices[v + 5] = bottomLeft;
+    }
+
+    std::vector<Field> fields;
+    std::vector<DigitSet> digitSets;
+    sf::RenderTexture texture;
+    sf::VertexArray vertices;
+    std::size_t layoutCount = 0;
+};
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "DinoRevengeCore.hpp"
+#include "SaveFile.hpp"
+
+// Repeticiones de DinoRevenge: la simulación es determinista (semilla propia y
+// paso fijo), así que alcanza con guardar la configuración de la partida y la
+// entrada de cada tick para reproducirla igual.
+//
+// Datos (dentro del contenedor de SaveFile.hpp, versión REPLAY_VERSION):
+//   dificultad u8 | personaje u8 | hoja del jugador u32 u32 | frames u8 |
+//   hojas de enemigos 3 x (u32 u32) | ancho del fondo f32 | semilla u64 |
+//   ticks u32 | checksum final u32 | score final i32 |
+//   tramos: (teclas u8, repeticiones varint)...
+// La entrada cambia pocas veces por segundo, así que se guarda por tramos de
+// ticks iguales: un minuto de juego ocupa unos cientos de bytes.
+const std::uint16_t REPLAY_VERSION = 1;
+
+// Las cinco teclas de TickInput en un byte
+inline std::uint8_t packTickInput(const TickInput& input) {
+    return static_cast<std::uint8_t>((input.left ? 1 : 0) | (input.right ? 2 : 0) | (input.jump ? 4 : 0) |
+                                     (input.duck ? 8 : 0) | (input.shoot ? 16 : 0));
+}
+
+inline TickInput unpackTickInput(std::uint8_t bits) {
+    TickInput input;
+    input.left = (bits & 1) != 0;
+    input.right = (bits & 2) != 0;
+    input.jump = (bits & 4) != 0;
+    input.duck = (bits & 8) != 0;
+    input.shoot = (bits & 16) != 0;
+    return input;
+}
+
+// Graba las entradas de una partida. record() solo agrega al tramo actual
+// o abre uno nuevo; no reserva memoria mientras la entrada no cambie.
+class InputRecorder {
+public:
+    void begin(const RunSetup& runSetup) {
+        setup = runSetup;
+        runs.clear();
+        ticks = 0;
+        recording = true;
+    }
+
+    bool isRecording() const {
+        return recording;
+    }
+
+    void record(const TickInput& input) {
+        if (!recording) {
+            return;
+        }
+        std::uint8_t bits = packTickInput(input);
+        if (runs.empty() || runs.back().bits != bits) {
+            runs.push_back({bits, 0});
+        }
+        ++runs.back().length;
+        ++ticks;
+    }
+
+    // Cierra la grabación y retorna el archivo completo
+    std::vector<std::uint8_t> finish(const DinoRevengeSimulation& sim) {
+        recording = false;
+
+        ByteWriter payload;
+        payload.u8(static_cast<std::uint8_t>(setup.difficulty));
+        payload.u8(setup.character);
+        payload.u32(setup.playerSheet.width);
+        payload.u32(setup.playerSheet.height);
+        payload.u8(setup.playerFrames);
+        for (const SheetSize& sheet : setup.enemySheets) {
+            payload.u32(sheet.width);
+            payload.u32(sheet.height);
+        }
+        payload.f32(setup.backgroundWidth);
+        payload.u64(setup.seed);
+        payload.u32(ticks);
+        payload.u32(sim.checksum());
+        payload.i32(sim.score);
+        for (const Run& run : runs) {
+            payload.u8(run.bits);
+            payload.varint(run.length);
+        }
+        return packSaveFile(REPLAY_VERSION, payload.getBytes());
+    }
+
+private:
+    struct Run {
+        std::uint8_t bits;
+        std::uint32_t length;
+    };
+
+    RunSetup setup;
+    std::vector<Run> runs;
+    std::uint32_t ticks = 0;
+    bool recording = false;
+};
+
+enum class ReplayStatus {
+    OK,
+    NOT_A_REPLAY,       // No es un archivo de guardado o es de otra versión
+    CORRUPT             // Cortado, CRC distinto o tramos que no suman los ticks
+};
+
+// Reproduce un archivo grabado con InputRecorder
+class InputReplay {
+public:
+    ReplayStatus load(const std::vector<std::uint8_t>& file) {
+        std::uint16_t version = 0;
+        std::vector<std::uint8_t> payload;
+        SaveFileStatus status = unpackSaveFile(file, version, payload);
+        if (status == SaveFileStatus::NOT_A_SAVE_FILE || (status == SaveFileStatus::OK && version != REPLAY_VERSION)) {
+            return ReplayStatus::NOT_A_REPLAY;
+        }
+        if (status != SaveFileStatus::OK) {
+            return ReplayStatus::CORRUPT;
+        }
+
+        ByteReader reader(payload);
+        std::uint8_t difficulty = reader.u8();
+        setup.difficulty = difficulty < GAME_DIFFICULTY_COUNT ? static_cast<GameDifficulty>(difficulty) : GameDifficulty::NORMAL;
+        setup.character = reader.u8();
+        setup.playerSheet.width = reader.u32();
+        setup.playerSheet.height = reader.u32();
+        setup.playerFrames = reader.u8();
+        for (SheetSize& sheet : setup.enemySheets) {
+            sheet.width = reader.u32();
+            sheet.height = reader.u32();
+        }
+        setup.backgroundWidth = reader.f32();
+        setup.seed = reader.u64();
+        ticks = reader.u32();
+        expectedChecksum = reader.u32();
+        expectedScore = reader.i32();
+
+        inputs.clear();
+        inputs.reserve(ticks);
+        while (reader.isOk() && !reader.atEnd()) {
+            std::uint8_t bits = reader.u8();
+            std::uint32_t length = reader.varint();
+            if (length > ticks - inputs.size()) {
+                return ReplayStatus::CORRUPT;
+            }
+            inputs.insert(inputs.end(), length, bits);
+        }
+        if (!reader.isOk() || inputs.size() != ticks || setup.playerFrames == 0) {
+            return ReplayStatus::CORRUPT;
+        }
+
+        position = 0;
+        return ReplayStatus::OK;
+    }
+
+    const RunSetup& getSetup() const {
+        return setup;
+    }
+
+    bool atEnd() const {
+        return position >= inputs.size();
+    }
+
+    // Entrada del próximo tick (sin teclas si ya terminó)
+    TickInput next() {
+        if (atEnd()) {
+            return TickInput();
+        }
+        return unpackTickInput(inputs[position++]);
+    }
+
+    // Vuelve al primer tick para reproducir otra vez
+    void rewind() {
+        position = 0;
+    }
+
+    std::uint32_t getTickCount() const {
+        return ticks;
+    }
+
+    std::uint32_t getExpectedChecksum() const {
+        return expectedChecksum;
+    }
+
+    int getExpectedScore() const {
+        return expectedScore;
+    }
+
+private:
+    RunSetup setup;
+    std::vector<std::uint8_t> inputs;
+    std::size_t position = 0;
+    std::uint32_t ticks = 0;
+    std::uint32_t expectedChecksum = 0;
+    int expectedScore = 0;
+};
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+// Récord de una tabla: nombre de largo fijo (sin memoria dinámica) y puntaje
+struct ScoreEntry {
+    static constexpr std::size_t MAX_NAME_LENGTH = 15;
+
+    std::array<char, MAX_NAME_LENGTH + 1> name{};
+    int score = 0;
+
+    std::string getName() const {
+        return std::string(name.data());
+    }
+
+    void setName(const std::string& value) {
+        std::size_t length = std::min(value.size(), MAX_NAME_LENGTH);
+        std::memcpy(name.data(), value.data(), length);
+        name[length] = '\0';
+    }
+};
+
+// Vista de una parte de una tabla, sin copiar: entradas [first, first + count)
+struct ScorePage {
+    const ScoreEntry* entries = nullptr;
+    std::size_t count = 0;
+    std::size_t firstRank = 0;      // Posición (desde 0) de entries[0] en la tabla
+};
+
+// Tabla de los mejores Capacity puntajes, siempre ordenada de mayor a menor.
+// Insertar busca la posición con búsqueda binaria y corre la cola un lugar;
+// si la tabla está llena, el último se cae. A igual puntaje queda primero el
+// que llegó antes.
+template <std::size_t Capacity>
+class Leaderboard {
+public:
+    static constexpr std::size_t capacity() {
+        return Capacity;
+    }
+
+    // Retorna la posición (desde 0) en la que quedó, o -1 si no entra en la tabla
+    int insert(const std::string& playerName, int score) {
+        const ScoreEntry* position = std::upper_bound(entries.data(), entries.data() + count, score,
+            [](int value, const ScoreEntry& entry) { return value > entry.score; });
+        std::size_t rank = static_cast<std::size_t>(position - entries.data());
+        if (rank >= Capacity) {
+            return -1;
+        }
+
+        std::size_t last = std::min(count, Capacity - 1);
+        std::move_backward(entries.begin() + rank, entries.begin() + last, entries.begin() + last + 1);
+        entries[rank].setName(playerName);
+        entries[rank].score = score;
+        if (count < Capacity) {
+            ++count;
+        }
+        return static_cast<int>(rank);
+    }
+
+    // true si un puntaje así entraría en la tabla
+    bool qualifies(int score) const {
+        return count < Capacity || score > entries[count - 1].score;
+    }
+
+    // Mejor puntaje (0 si la tabla está vacía)
+    int best() const {
+        return count > 0 ? entries[0].score : 0;
+    }
+
+    std::size_t size() const {
+        return count;
+    }
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    const ScoreEntry& operator[](std::size_t rank) const {
+        return entries[rank];
+    }
+
+    // Página 'page' de pageSize entradas (la última puede venir incompleta o vacía)
+    ScorePage getPage(std::size_t page, std::size_t pageSize) const {
+        ScorePage result;
+        result.firstRank = std::min(page * pageSize, count);
+        result.entries = entries.data() + result.firstRank;
+        result.count = std::min(pageSize, count - result.firstRank);
+        return result;
+    }
+
+    ScorePage all() const {
+        return getPage(0, Capacity);
+    }
+
+    void clear() {
+        count = 0;
+    }
+
+private:
+    std::array<ScoreEntry, Capacity> entries;
+    std::size_t count = 0;
+};
+
+// Una tabla por valor de un enum (por ejemplo GameDifficulty), guardadas juntas
+// e indexadas directamente por el enum
+template <class Key, std::size_t KeyCount, std::size_t Capacity>
+class LeaderboardSet {
+public:
+    Leaderboard<Capacity>& operator[](Key key) {
+        return boards[static_cast<std::size_t>(key)];
+    }
+
+    const Leaderboard<Capacity>& operator[](Key key) const {
+        return boards[static_cast<std::size_t>(key)];
+    }
+
+    static constexpr std::size_t keyCount() {
+        return KeyCount;
+    }
+
+    void clear() {
+        for (auto& board : boards) {
+            board.clear();
+        }
+    }
+
+private:
+    std::array<Leaderboard<Capacity>, KeyCount> boards;
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "Random.hpp"
+
+// Enlace de paquetes con retardo, variación y pérdida artificiales, para
+// probar el modo en red en una sola máquina (por 127.0.0.1 o sin sockets,
+// como en bench/TronNetLoopback.cpp). Un paquete enviado se descarta con
+// probabilidad lossRate o queda retenido delayMs + [0, jitterMs] ms; con
+// variación los paquetes pueden llegar desordenados, como en UDP real.
+//
+// La capacidad es fija: si se llena, el paquete se pierde.
+class LossyLink {
+public:
+    static const std::size_t MAX_PACKET = 64;
+    static const std::size_t CAPACITY = 256;
+
+    LossyLink(std::uint32_t delayMs = 0, std::uint32_t jitterMs = 0, float lossRate = 0.0f, std::uint64_t seed = 0)
+        : delayMs(delayMs), jitterMs(jitterMs), lossRate(lossRate), random(seed) {}
+
+    // Retorna false si el paquete se perdió (a propósito, por tamaño o por falta de lugar)
+    bool send(const std::uint8_t* data, std::size_t size, std::uint64_t nowMs) {
+        ++sentCount;
+        if (size > MAX_PACKET || (lossRate > 0.0f && random.nextFloat() < lossRate)) {
+            ++droppedCount;
+            return false;
+        }
+        for (Packet& packet : packets) {
+            if (!packet.used) {
+                packet.used = true;
+                packet.deliverAt = nowMs + delayMs + (jitterMs > 0 ? random.nextInt(jitterMs + 1) : 0);
+                packet.size = size;
+                std::memcpy(packet.bytes, data, size);
+                return true;
+            }
+        }
+        ++droppedCount;
+        return false;
+    }
+
+    // Copia en out el paquete que llegó primero (si ya llegó alguno) y retorna
+    // su tamaño, o 0 si no hay ninguno listo
+    std::size_t receive(std::uint64_t nowMs, std::uint8_t* out, std::size_t capacity) {
+        Packet* first = nullptr;
+        for (Packet& packet : packets) {
+            if (packet.used && packet.deliverAt <= nowMs && (!first || packet.deliverAt < first->deliverAt)) {
+                first = &packet;
+            }
+        }
+        if (!first || first->size > capacity) {
+            return 0;
+        }
+        first->used = false;
+        std::memcpy(out, first->bytes, first->size);
+        return first->size;
+    }
+
+    std::uint64_t getSentCount() const {
+        return sentCount;
+    }
+
+    std::uint64_t getDroppedCount() const {
+        return droppedCount;
+    }
+
+private:
+    struct Packet {
+        std::uint64_t deliverAt = 0;
+        std::size_t size = 0;
+        std::uint8_t bytes[MAX_PACKET];
+        bool used = false;
+    };
+
+    std::uint32_t delayMs;
+    std::uint32_t jitterMs;
+    float lossRate;
+    Xoshiro128 random;
+    Packet packets[CAPACITY];
+    std::uint64_t sentCount = 0;
+    std::uint64_t droppedCount = 0;
+};
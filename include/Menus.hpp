@@ -0,0 +1,17 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include "GameConfig.hpp"
+#include "ResourceCache.hpp"
+
+// Pantallas de menú comunes a 18_DinoRevengeSelect y 28_MenuSystem.
+// Implementación en lib/Menus.cpp. Mientras están abiertas siguen avanzando
+// la carga en segundo plano de resources.loader.
+
+// Volúmenes de música y efectos; al salir con ESC se guarda la configuración
+void showSettings(sf::RenderWindow& window, GameResources& resources, GameConfig& config);
+
+// Récords de cada dificultad; con izquierda/derecha se cambia de tabla
+void showHighScores(sf::RenderWindow& window, GameResources& resources, const GameConfig& config,
+                    GameDifficulty difficulty = GameDifficulty::NORMAL);
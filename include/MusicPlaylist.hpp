@@ -0,0 +1,281 @@
+#pragma once
+
+#include <SFML/Audio.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+enum class PlaylistCommand {
+    PLAY,
+    PAUSE,
+    RESUME,
+    RESTART,    // Volver al primer tema y reproducir
+    STOP
+};
+
+// Lista de temas reproducida como un solo stream. Todo el trabajo ocurre en el
+// hilo de audio de SFML (onGetData): mientras suena un tema, el siguiente se
+// abre y se decodifica por adelantado, y los dos se mezclan con un crossfade
+// de potencia constante que empieza en una muestra exacta antes del final.
+// Con crossfade 0 los temas quedan pegados sin hueco.
+//
+// El hilo principal solo manda comandos (command()); no hace falta revisar el
+// estado de la música en cada frame. RESTART y STOP pasan por onSeek() en el
+// hilo principal y reabren los decodificadores, así que onGetData() y onSeek()
+// toman el mismo mutex (como sf::Music).
+class MusicPlaylist : public sf::SoundStream {
+public:
+    static const std::size_t CHUNK_FRAMES = 4096;          // ~93 ms a 44.1 kHz
+    static constexpr float LOOKAHEAD_SECONDS = 3.0f;       // Antes del crossfade se empieza a decodificar el siguiente
+
+    ~MusicPlaylist() override {
+        stop(); // El stream debe detenerse antes de destruir los datos de la clase derivada
+    }
+
+    // Abre la lista. Todos los temas deben tener los mismos canales y frecuencia.
+    // loop = true vuelve al primer tema después del último.
+    bool openFromFiles(const std::vector<std::string>& files, float crossfadeSeconds = 1.5f, bool loop = true) {
+        stop();
+        if (files.empty()) {
+            return false;
+        }
+
+        std::uint64_t shortestTrack = ~std::uint64_t(0);
+        for (std::size_t i = 0; i < files.size(); ++i) {
+            sf::InputSoundFile file;
+            if (!file.openFromFile(files[i])) {
+                return false;
+            }
+            if (i == 0) {
+                channelCount = file.getChannelCount();
+                sampleRate = file.getSampleRate();
+                channelMap = file.getChannelMap();
+            } else if (file.getChannelCount() != channelCount || file.getSampleRate() != sampleRate) {
+                return false;
+            }
+            shortestTrack = std::min(shortestTrack, file.getSampleCount() / channelCount);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            paths = files;
+            looping = loop;
+            // El crossfade no puede ocupar más de la mitad del tema más corto
+            crossfadeFrames = std::min(static_cast<std::uint64_t>(crossfadeSeconds * sampleRate), shortestTrack / 2);
+            lookaheadFrames = static_cast<std::uint64_t>(LOOKAHEAD_SECONDS * sampleRate);
+
+            output.resize(CHUNK_FRAMES * channelCount);
+            preroll.resize(crossfadeFrames * channelCount);
+        }
+
+        initialize(channelCount, sampleRate, channelMap);
+        std::lock_guard<std::mutex> lock(mutex);
+        return startTrack(0, 0);
+    }
+
+    void command(PlaylistCommand cmd) {
+        switch (cmd) {
+            case PlaylistCommand::PLAY:
+            case PlaylistCommand::RESUME:
+                if (getStatus() != Status::Playing) {
+                    play();
+                }
+                break;
+            case PlaylistCommand::PAUSE:
+                if (getStatus() == Status::Playing) {
+                    pause();
+                }
+                break;
+            case PlaylistCommand::RESTART:
+                stop(); // stop() vuelve al inicio (onSeek)
+                play();
+                break;
+            case PlaylistCommand::STOP:
+                stop();
+                break;
+        }
+    }
+
+    // Tema que está sonando (se puede consultar desde cualquier hilo)
+    std::size_t getCurrentTrack() const {
+        return currentTrackIndex.load(std::memory_order_relaxed);
+    }
+
+    std::size_t getTrackCount() const {
+        return paths.size();
+    }
+
+protected:
+    bool onGetData(Chunk& data) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (paths.empty()) {
+            return false;
+        }
+
+        // Terminó el tema: el siguiente sigue donde quedó su pre-decodificación
+        if (position >= trackFrames) {
+            if (hasNext) {
+                finishCrossfade();
+            }
+            if (position >= trackFrames) {
+                return false;
+            }
+        }
+
+        std::uint64_t fadeStart = trackFrames - (hasNext ? crossfadeFrames : 0);
+        std::uint64_t frames = CHUNK_FRAMES;
+        if (position < fadeStart) {
+            // Cortar el bloque justo en el comienzo del crossfade
+            frames = std::min(frames, fadeStart - position);
+        } else {
+            frames = std::min(frames, trackFrames - position);
+        }
+
+        std::uint64_t read = decks[currentDeck].read(output.data(), frames * channelCount) / channelCount;
+        if (read < frames) {
+            // El archivo trajo menos muestras de las anunciadas: completar con silencio
+            std::fill(output.begin() + read * channelCount, output.begin() + frames * channelCount, 0);
+        }
+
+        if (position >= fadeStart && hasNext) {
+            decodeNext(crossfadeFrames); // Por si la lectura anticipada no alcanzó
+            if (hasNext) {
+                mixCrossfade(position - fadeStart, frames);
+            }
+        } else if (hasNext && position + frames + lookaheadFrames >= fadeStart) {
+            decodeNext(prerollFrames + CHUNK_FRAMES * 2);
+        }
+
+        position += frames;
+        data.samples = output.data();
+        data.sampleCount = static_cast<std::size_t>(frames * channelCount);
+        return true;
+    }
+
+    void onSeek(sf::Time offset) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (paths.empty()) {
+            return;
+        }
+        startTrack(0, static_cast<std::uint64_t>(offset.asSeconds() * sampleRate));
+    }
+
+private:
+    bool startTrack(std::size_t track, std::uint64_t offsetFrames) {
+        currentDeck = 0;
+        if (!openDeck(currentDeck, track)) {
+            return false;
+        }
+        trackFrames = decks[currentDeck].getSampleCount() / channelCount;
+        position = std::min(offsetFrames, trackFrames);
+        decks[currentDeck].seek(position * channelCount);
+        prepareNext();
+        return true;
+    }
+
+    bool openDeck(std::size_t deck, std::size_t track) {
+        deckTrack[deck] = track;
+        return decks[deck].openFromFile(paths[track]);
+    }
+
+    // Elige el tema siguiente; se abre recién al entrar en la ventana de lectura anticipada
+    void prepareNext() {
+        currentTrackIndex.store(deckTrack[currentDeck], std::memory_order_relaxed);
+        std::size_t next = deckTrack[currentDeck] + 1;
+        if (next >= paths.size()) {
+            next = 0;
+            hasNext = looping;
+        } else {
+            hasNext = true;
+        }
+        nextTrack = next;
+        nextOpened = false;
+        prerollFrames = 0;
+    }
+
+    // Decodifica el comienzo del tema siguiente hasta 'targetFrames' (máximo el largo del crossfade)
+    void decodeNext(std::uint64_t targetFrames) {
+        std::size_t nextDeck = 1 - currentDeck;
+        if (!nextOpened) {
+            if (!openDeck(nextDeck, nextTrack)) {
+                hasNext = false; // Sin siguiente: el tema actual termina sin crossfade
+                return;
+            }
+            nextOpened = true;
+        }
+
+        targetFrames = std::min(targetFrames, crossfadeFrames);
+        while (prerollFrames < targetFrames) {
+            std::uint64_t wanted = targetFrames - prerollFrames;
+            std::uint64_t read = decks[nextDeck].read(preroll.data() + prerollFrames * channelCount, wanted * channelCount) / channelCount;
+            if (read == 0) {
+                std::fill(preroll.begin() + prerollFrames * channelCount, preroll.begin() + targetFrames * channelCount, 0);
+                read = wanted;
+            }
+            prerollFrames += read;
+        }
+    }
+
+    // Mezcla 'frames' cuadros del tema actual con el siguiente, empezando en
+    // 'fadeFrame' cuadros desde el inicio del crossfade
+    void mixCrossfade(std::uint64_t fadeFrame, std::uint64_t frames) {
+        const float halfPi = 1.57079633f;
+        for (std::uint64_t f = 0; f < frames; ++f) {
+            float t = static_cast<float>(fadeFrame + f) / crossfadeFrames;
+            float outGain = std::cos(t * halfPi);
+            float inGain = std::sin(t * halfPi);
+            for (unsigned c = 0; c < channelCount; ++c) {
+                std::size_t outIndex = f * channelCount + c;
+                std::size_t inIndex = (fadeFrame + f) * channelCount + c;
+                float mixed = output[outIndex] * outGain + preroll[inIndex] * inGain;
+                mixed = std::max(-32768.0f, std::min(32767.0f, mixed));
+                output[outIndex] = static_cast<std::int16_t>(mixed);
+            }
+        }
+    }
+
+    // Pasa el tema siguiente a ser el actual. Su parte ya mezclada en el
+    // crossfade no se vuelve a reproducir.
+    void finishCrossfade() {
+        if (!nextOpened) {
+            decodeNext(crossfadeFrames);
+            if (!hasNext) {
+                return;
+            }
+        }
+        currentDeck = 1 - currentDeck;
+        trackFrames = decks[currentDeck].getSampleCount() / channelCount;
+        position = crossfadeFrames;
+        prepareNext();
+    }
+
+    std::vector<std::string> paths;
+    unsigned channelCount = 0;
+    unsigned sampleRate = 0;
+    std::vector<sf::SoundChannel> channelMap;
+    bool looping = true;
+    std::uint64_t crossfadeFrames = 0;
+    std::uint64_t lookaheadFrames = 0;
+
+    // Dos decodificadores: el tema actual y el siguiente (pueden ser el mismo archivo)
+    sf::InputSoundFile decks[2];
+    std::size_t deckTrack[2] = {0, 0};
+    std::size_t currentDeck = 0;
+    std::uint64_t trackFrames = 0;
+    std::uint64_t position = 0;     // Cuadros ya entregados del tema actual
+
+    std::size_t nextTrack = 0;
+    bool hasNext = false;
+    bool nextOpened = false;
+    std::vector<std::int16_t> preroll;   // Comienzo del tema siguiente, para el crossfade
+    std::uint64_t prerollFrames = 0;
+
+    std::vector<std::int16_t> output;
+    std::atomic<std::size_t> currentTrackIndex{0};
+    std::mutex mutex;   // Decodificadores y estado del tema: hilo de audio contra onSeek() del principal
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Rejilla de ocupación de la arena de Tron: cada celda guarda qué jugador la
+// ocupa (0 = libre) en 4 bits, 16 celdas por palabra de 64 bits. Consultar o
+// marcar una celda es O(1) sin importar el largo de las estelas; al avanzar,
+// cada cabeza marca solo su celda nueva. Una arena de 1000x1000 ocupa ~500 KB.
+// No depende de SFML.
+class OccupancyGrid {
+public:
+    static const unsigned BITS_PER_CELL = 4;
+    static const std::uint8_t EMPTY = 0;
+    static const std::uint8_t MAX_OWNER = (1 << BITS_PER_CELL) - 1;
+
+    OccupancyGrid(int width = 0, int height = 0) {
+        resize(width, height);
+    }
+
+    // Cambia el tamaño y deja todas las celdas libres
+    void resize(int newWidth, int newHeight) {
+        width = newWidth > 0 ? newWidth : 0;
+        height = newHeight > 0 ? newHeight : 0;
+        std::size_t cells = static_cast<std::size_t>(width) * height;
+        words.assign((cells + CELLS_PER_WORD - 1) / CELLS_PER_WORD, 0);
+    }
+
+    void clear() {
+        words.assign(words.size(), 0);
+    }
+
+    int getWidth() const {
+        return width;
+    }
+
+    int getHeight() const {
+        return height;
+    }
+
+    bool contains(int x, int y) const {
+        return x >= 0 && y >= 0 && x < width && y < height;
+    }
+
+    // Dueño de la celda (EMPTY si está libre). Fuera de la rejilla cuenta como libre.
+    std::uint8_t get(int x, int y) const {
+        if (!contains(x, y)) {
+            return EMPTY;
+        }
+        std::size_t cell = index(x, y);
+        return static_cast<std::uint8_t>((words[cell / CELLS_PER_WORD] >> shift(cell)) & MAX_OWNER);
+    }
+
+    bool isOccupied(int x, int y) const {
+        return get(x, y) != EMPTY;
+    }
+
+    // owner entre 1 y MAX_OWNER (EMPTY libera la celda)
+    void set(int x, int y, std::uint8_t owner) {
+        if (!contains(x, y)) {
+            return;
+        }
+        std::size_t cell = index(x, y);
+        std::uint64_t& word = words[cell / CELLS_PER_WORD];
+        word &= ~(std::uint64_t(MAX_OWNER) << shift(cell));
+        word |= std::uint64_t(owner & MAX_OWNER) << shift(cell);
+    }
+
+private:
+    static const std::size_t CELLS_PER_WORD = 64 / BITS_PER_CELL;
+
+    std::size_t index(int x, int y) const {
+        return static_cast<std::size_t>(y) * width + x;
+    }
+
+    static unsigned shift(std::size_t cell) {
+        return static_cast<unsigned>(cell % CELLS_PER_WORD) * BITS_PER_CELL;
+    }
+
+    int width = 0;
+    int height = 0;
+    std::vector<std::uint64_t> words;
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Fondo con scroll infinito por capas. Cada capa es un solo quad del ancho de
+// la pantalla sobre una textura repetida (setRepeated): desplazarla es mover
+// las coordenadas de textura, sin sprites duplicados que se turnan. Cada pixel
+// de la banda se dibuja una sola vez por capa.
+//
+// speedRatio define la profundidad: 1 avanza con el juego, valores menores
+// quedan más lejos. Cada capa ocupa una franja vertical (top, height) y la
+// textura se escala para cubrir esa altura manteniendo la proporción.
+class ParallaxBackground {
+public:
+    explicit ParallaxBackground(float width) : width(width) {}
+
+    // Agrega una capa (se dibujan en el orden en que se agregan: la primera
+    // queda atrás). La textura pasa a repetirse. Retorna el índice de la capa.
+    std::size_t addLayer(sf::Texture& texture, float speedRatio, float top, float height,
+                         sf::Color tint = sf::Color::White) {
+        texture.setRepeated(true);
+
+        Layer layer;
+        layer.texture = &texture;
+        layer.speedRatio = speedRatio;
+        sf::Vector2u size = texture.getSize();
+        layer.textureWidth = static_cast<float>(size.x);
+        float scale = size.y > 0 ? height / size.y : 1.0f;
+        layer.texelsPerPixel = scale > 0.0f ? 1.0f / scale : 1.0f;
+
+        float visibleTexels = width * layer.texelsPerPixel;
+        layer.quad[0] = sf::Vertex{sf::Vector2f(0, top), tint, sf::Vector2f(0, 0)};
+        layer.quad[1] = sf::Vertex{sf::Vector2f(width, top), tint, sf::Vector2f(visibleTexels, 0)};
+        layer.quad[2] = sf::Vertex{sf::Vector2f(0, top + height), tint, sf::Vector2f(0, static_cast<float>(size.y))};
+        layer.quad[3] = sf::Vertex{sf::Vector2f(width, top + height), tint, sf::Vector2f(visibleTexels, static_cast<float>(size.y))};
+        layers.push_back(layer);
+        return layers.size() - 1;
+    }
+
+    // Ancho en pantalla de una repetición de la textura de la capa
+    float getTileWidth(std::size_t layer) const {
+        return layers[layer].textureWidth / layers[layer].texelsPerPixel;
+    }
+
+    // Distancia recorrida por el juego en pixeles de pantalla (crece hacia la
+    // derecha del mundo). Solo actualiza 4 coordenadas de textura por capa.
+    void setScroll(float distance) {
+        for (Layer& layer : layers) {
+            // Se reduce a una repetición para no perder precisión con distancias grandes
+            float offset = std::fmod(distance * layer.speedRatio * layer.texelsPerPixel, layer.textureWidth);
+            if (offset < 0.0f) {
+                offset += layer.textureWidth;
+            }
+            float right = offset + width * layer.texelsPerPixel;
+            layer.quad[0].texCoords.x = offset;
+            layer.quad[1].texCoords.x = right;
+            layer.quad[2].texCoords.x = offset;
+            layer.quad[3].texCoords.x = right;
+        }
+    }
+
+    // Retorna las llamadas de dibujo hechas (una por capa)
+    std::size_t draw(sf::RenderTarget& target) const {
+        for (const Layer& layer : layers) {
+            target.draw(layer.quad, 4, sf::PrimitiveType::TriangleStrip, sf::RenderStates(layer.texture));
+        }
+        return layers.size();
+    }
+
+private:
+    struct Layer {
+        const sf::Texture* texture = nullptr;
+        float speedRatio = 1.0f;
+        float textureWidth = 0.0f;
+        float texelsPerPixel = 1.0f;
+        sf::Vertex quad[4];
+    };
+
+    float width;
+    std::vector<Layer> layers;
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+
+#include "ParticleSystem.hpp"
+#include "PrimitiveBatch.hpp"
+
+// Agrega todas las partículas vivas a un batch (una sola llamada de dibujo al
+// hacer flush). alpha interpola entre el paso anterior y el actual.
+template <std::size_t Capacity>
+void batchParticles(PrimitiveBatch& batch, const ParticleSystem<Capacity>& particles, float alpha = 1.0f) {
+    particles.forEachAlive([&](std::size_t i) {
+        sf::Vector2f center(particles.previousX[i] + (particles.x[i] - particles.previousX[i]) * alpha,
+                            particles.previousY[i] + (particles.y[i] - particles.previousY[i]) * alpha);
+        sf::Color color(particles.red[i], particles.green[i], particles.blue[i], particles.alphaAt(i));
+        batch.circle(center, particles.radius[i], color, particles.pointCount[i]);
+    });
+}
@@ -0,0 +1,218 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "Random.hpp"
+
+// Preset de emisor: cuántas partículas salen por disparo, cómo se reparten y
+// cómo se ven. Los presets de cada juego son constantes globales.
+struct ParticleEmitter {
+    int count;
+    float minSpeed;
+    float maxSpeed;
+    bool wholeSpeeds;       // true = solo velocidades enteras de minSpeed a maxSpeed inclusive
+    bool evenSpread;        // true = ángulos repartidos en partes iguales, false = aleatorios
+    float gravity;          // Se suma a la velocidad vertical en cada paso
+    float lifetime;         // Segundos
+    bool fade;              // Desvanecer la transparencia durante la vida
+    float radius;
+    bool cornerAtEmitPoint; // true = la esquina superior izquierda (no el centro) queda en el punto de emisión
+    std::uint8_t pointCount;
+    std::uint8_t minRed, minGreen, minBlue;
+    std::uint8_t maxRed, maxGreen, maxBlue;
+};
+
+// Los presets de los juegos reproducen los sf::CircleShape que usaban antes:
+// 30 puntos (el valor por defecto de SFML), posicionados por la esquina y, en
+// 18_DinoRevengeSelect, con velocidad 2 + rand() % 3.
+
+// Explosión de 18_DinoRevengeSelect: 20 chispas en direcciones aleatorias que caen
+const ParticleEmitter DINO_REVENGE_EXPLOSION = {
+    20, 2.0f, 4.0f, true, false, 0.2f, 0.5f, false, 3.0f, true, 30,
+    255, 100, 0,
+    255, 255, 0
+};
+
+// Explosión de 10_DinoRevenge: 8 partículas en estrella que se desvanecen
+const ParticleEmitter DINO_CLASSIC_EXPLOSION = {
+    8, 3.0f, 3.0f, false, true, 0.0f, 0.5f, true, 4.0f, true, 30,
+    255, 150, 0,
+    255, 249, 0
+};
+
+// Sistema de partículas de capacidad fija. Las partículas viven en un buffer
+// circular en columnas (SoA): las nuevas se escriben en 'head' y las más viejas
+// se retiran por 'tail', así que emitir y expirar nunca mueve datos ni reserva
+// memoria. Si el buffer se llena, la partícula más vieja se reemplaza.
+//
+// La integración recorre arreglos contiguos de floats sin ramas para que el
+// compilador la vectorice. No depende de SFML; ver PrimitiveBatch para dibujar.
+template <std::size_t Capacity>
+class ParticleSystem {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "La capacidad debe ser potencia de 2");
+
+public:
+    std::array<float, Capacity> x;
+    std::array<float, Capacity> y;
+    std::array<float, Capacity> previousX;
+    std::array<float, Capacity> previousY;
+    std::array<float, Capacity> velocityX;
+    std::array<float, Capacity> velocityY;
+    std::array<float, Capacity> gravity;
+    std::array<float, Capacity> age;
+    std::array<float, Capacity> lifetime;
+    std::array<float, Capacity> fadeRate;   // 1 / lifetime si se desvanece, 0 si no
+    std::array<float, Capacity> radius;
+    std::array<std::uint8_t, Capacity> red;
+    std::array<std::uint8_t, Capacity> green;
+    std::array<std::uint8_t, Capacity> blue;
+    std::array<std::uint8_t, Capacity> pointCount;
+
+    // Ángulos, velocidades y colores aleatorios salen de acá (sembrar con seed())
+    Xoshiro128 random;
+
+    static constexpr std::size_t capacity() {
+        return Capacity;
+    }
+
+    // Partículas en el buffer (algunas pueden haber expirado antes que las más viejas)
+    std::size_t size() const {
+        return count;
+    }
+
+    void clear() {
+        tail = 0;
+        count = 0;
+    }
+
+    void emit(const ParticleEmitter& emitter, float startX, float startY) {
+        if (emitter.cornerAtEmitPoint) {
+            startX += emitter.radius;
+            startY += emitter.radius;
+        }
+        for (int n = 0; n < emitter.count; ++n) {
+            std::size_t i = push();
+
+            float angle;
+            if (emitter.evenSpread) {
+                angle = n * 2.0f * 3.14159f / emitter.count;
+            } else {
+                angle = random.nextInt(360) * 3.14159f / 180.0f;
+            }
+            float speed;
+            if (emitter.wholeSpeeds) {
+                std::uint32_t steps = static_cast<std::uint32_t>(emitter.maxSpeed - emitter.minSpeed) + 1;
+                speed = emitter.minSpeed + static_cast<float>(random.nextInt(steps));
+            } else {
+                speed = emitter.minSpeed + (emitter.maxSpeed - emitter.minSpeed) * random.nextFloat();
+            }
+
+            x[i] = startX;
+            y[i] = startY;
+            previousX[i] = startX;
+            previousY[i] = startY;
+            velocityX[i] = std::cos(angle) * speed;
+            velocityY[i] = std::sin(angle) * speed;
+            gravity[i] = emitter.gravity;
+            age[i] = 0.0f;
+            lifetime[i] = emitter.lifetime;
+            fadeRate[i] = emitter.fade ? 1.0f / emitter.lifetime : 0.0f;
+            radius[i] = emitter.radius;
+            red[i] = randomChannel(emitter.minRed, emitter.maxRed);
+            green[i] = randomChannel(emitter.minGreen, emitter.maxGreen);
+            blue[i] = randomChannel(emitter.minBlue, emitter.maxBlue);
+            pointCount[i] = emitter.pointCount;
+        }
+    }
+
+    // Un paso: posición += velocidad, luego velocidad vertical += gravedad
+    void update(float deltaTime) {
+        forEachSpan([&](std::size_t begin, std::size_t end) {
+            integrate(begin, end, deltaTime);
+        });
+
+        // Retirar las partículas expiradas desde la más vieja
+        while (count > 0 && age[tail] >= lifetime[tail]) {
+            tail = (tail + 1) & MASK;
+            --count;
+        }
+    }
+
+    // Transparencia 0-255 según la edad (255 si el preset no se desvanece)
+    std::uint8_t alphaAt(std::size_t i) const {
+        float alpha = 1.0f - age[i] * fadeRate[i];
+        if (alpha <= 0.0f) return 0;
+        return static_cast<std::uint8_t>(255 * alpha);
+    }
+
+    // Llama a visit(i) por cada partícula viva, de la más vieja a la más nueva
+    template <class Visitor>
+    void forEachAlive(Visitor&& visit) const {
+        for (std::size_t n = 0; n < count; ++n) {
+            std::size_t i = (tail + n) & MASK;
+            if (age[i] < lifetime[i]) {
+                visit(i);
+            }
+        }
+    }
+
+private:
+    static constexpr std::size_t MASK = Capacity - 1;
+
+    // Reserva el siguiente lugar; si está lleno se descarta la más vieja
+    std::size_t push() {
+        if (count == Capacity) {
+            tail = (tail + 1) & MASK;
+            --count;
+        }
+        std::size_t i = (tail + count) & MASK;
+        ++count;
+        return i;
+    }
+
+    std::uint8_t randomChannel(std::uint8_t minValue, std::uint8_t maxValue) {
+        if (maxValue <= minValue) return minValue;
+        return static_cast<std::uint8_t>(minValue + random.nextInt(maxValue - minValue + 1));
+    }
+
+    // El rango vivo del buffer circular son uno o dos tramos contiguos
+    template <class Callback>
+    void forEachSpan(Callback&& onSpan) const {
+        if (count == 0) {
+            return;
+        }
+        std::size_t end = tail + count;
+        if (end <= Capacity) {
+            onSpan(tail, end);
+        } else {
+            onSpan(tail, Capacity);
+            onSpan(0, end - Capacity);
+        }
+    }
+
+    void integrate(std::size_t begin, std::size_t end, float deltaTime) {
+        float* px = x.data();
+        float* py = y.data();
+        float* prevX = previousX.data();
+        float* prevY = previousY.data();
+        const float* vx = velocityX.data();
+        float* vy = velocityY.data();
+        const float* g = gravity.data();
+        float* a = age.data();
+
+        for (std::size_t i = begin; i < end; ++i) {
+            prevX[i] = px[i];
+            prevY[i] = py[i];
+            px[i] += vx[i];
+            py[i] += vy[i];
+            vy[i] += g[i];
+            a[i] += deltaTime;
+        }
+    }
+
+    std::size_t tail = 0;
+    std::size_t count = 0;
+};
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Batcher de primitivas en modo inmediato. Cada frame se agregan rectángulos,
+// círculos, triángulos o polígonos convexos (con relleno y contorno) y todos
+// se teselan en un solo sf::VertexArray de triángulos que se dibuja con una
+// sola llamada en flush(). Se usa un batch por capa de dibujo.
+//
+// El sf::VertexArray conserva su memoria entre frames, así que después del
+// primer frame agregar primitivas no reserva memoria.
+class PrimitiveBatch {
+public:
+    static const std::size_t MAX_POLYGON_POINTS = 64;
+
+    PrimitiveBatch() : vertices(sf::PrimitiveType::Triangles) {}
+
+    void clear() {
+        vertices.clear();
+    }
+
+    bool empty() const {
+        return vertices.getVertexCount() == 0;
+    }
+
+    std::size_t triangleCount() const {
+        return vertices.getVertexCount() / 3;
+    }
+
+    // Dibuja todo lo acumulado en una sola llamada y vacía el batch. Retorna
+    // las llamadas de dibujo hechas (0 si estaba vacío).
+    std::size_t flush(sf::RenderTarget& target, const sf::RenderStates& states = sf::RenderStates::Default) {
+        std::size_t drawCalls = 0;
+        if (!empty()) {
+            target.draw(vertices, states);
+            drawCalls = 1;
+        }
+        clear();
+        return drawCalls;
+    }
+
+    // Rectángulo con esquina superior izquierda en 'position', como sf::RectangleShape
+    void rect(sf::Vector2f position, sf::Vector2f size, sf::Color fill,
+              float outlineThickness = 0.0f, sf::Color outlineColor = sf::Color::Transparent) {
+        sf::Vector2f points[4] = {
+            position,
+            sf::Vector2f(position.x + size.x, position.y),
+            sf::Vector2f(position.x + size.x, position.y + size.y),
+            sf::Vector2f(position.x, position.y + size.y)
+        };
+        polygon(points, 4, fill, outlineThickness, outlineColor);
+    }
+
+    // Círculo definido por su centro. pointCount controla la calidad (SFML usa 30);
+    // para partículas pequeñas bastan 6-8 puntos.
+    void circle(sf::Vector2f center, float radius, sf::Color fill, std::size_t pointCount = 30,
+                float outlineThickness = 0.0f, sf::Color outlineColor = sf::Color::Transparent) {
+        if (pointCount < 3) pointCount = 3;
+        if (pointCount > MAX_POLYGON_POINTS) pointCount = MAX_POLYGON_POINTS;
+
+        const std::vector<sf::Vector2f>& unit = unitCircle(pointCount);
+        for (std::size_t i = 0; i < pointCount; ++i) {
+            scratch[i] = sf::Vector2f(center.x + unit[i].x * radius, center.y + unit[i].y * radius);
+        }
+        polygon(scratch.data(), pointCount, fill, outlineThickness, outlineColor);
+    }
+
+    void triangle(sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Color fill,
+                  float outlineThickness = 0.0f, sf::Color outlineColor = sf::Color::Transparent) {
+        sf::Vector2f points[3] = {a, b, c};
+        polygon(points, 3, fill, outlineThickness, outlineColor);
+    }
+
+    // Rectángulo texturizado (un sprite). textureRect está en pixeles de la
+    // textura con la que se haga flush(); flipX lo refleja horizontalmente.
+    void quad(sf::Vector2f position, sf::Vector2f size, const sf::IntRect& textureRect,
+              bool flipX = false, sf::Color color = sf::Color::White) {
+        float left = static_cast<float>(textureRect.position.x);
+        float right = left + textureRect.size.x;
+        float top = static_cast<float>(textureRect.position.y);
+        float bottom = top + textureRect.size.y;
+        if (flipX) {
+            std::swap(left, right);
+        }
+
+        sf::Vertex topLeft{position, color, sf::Vector2f(left, top)};
+        sf::Vertex topRight{sf::Vector2f(position.x + size.x, position.y), color, sf::Vector2f(right, top)};
+        sf::Vertex bottomRight{sf::Vector2f(position.x + size.x, position.y + size.y), color, sf::Vector2f(right, bottom)};
+        sf::Vertex bottomLeft{sf::Vector2f(position.x, position.y + size.y), color, sf::Vector2f(left, bottom)};
+
+        vertices.append(topLeft);
+        vertices.append(topRight);
+        vertices.append(bottomRight);
+        vertices.append(topLeft);
+        vertices.append(bottomRight);
+        vertices.append(bottomLeft);
+    }
+
+    // Copia triángulos ya teselados (una ShapeMesh) desplazados en 'offset'
+    void append(const sf::VertexArray& triangles, sf::Vector2f offset) {
+        for (std::size_t i = 0; i < triangles.getVertexCount(); ++i) {
+            sf::Vertex vertex = triangles[i];
+            vertex.position += offset;
+            vertices.append(vertex);
+        }
+    }
+
+    const sf::VertexArray& getVertices() const {
+        return vertices;
+    }
+
+    // Polígono convexo. El contorno crece hacia afuera, igual que en sf::Shape.
+    void polygon(const sf::Vector2f* points, std::size_t count, sf::Color fill,
+                 float outlineThickness = 0.0f, sf::Color outlineColor = sf::Color::Transparent) {
+        if (count < 3) {
+            return;
+        }
+
+        if (fill.a > 0) {
+            for (std::size_t i = 1; i + 1 < count; ++i) {
+                addTriangle(points[0], points[i], points[i + 1], fill);
+            }
+        }
+
+        if (outlineThickness != 0.0f && outlineColor.a > 0) {
+            addOutline(points, count, outlineThickness, outlineColor);
+        }
+    }
+
+private:
+    void addTriangle(sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Color color) {
+        vertices.append(sf::Vertex{a, color, sf::Vector2f()});
+        vertices.append(sf::Vertex{b, color, sf::Vector2f()});
+        vertices.append(sf::Vertex{c, color, sf::Vector2f()});
+    }
+
+    // Mismo cálculo de normales que sf::Shape: cada vértice se desplaza a lo
+    // largo del promedio de las normales de sus dos aristas
+    void addOutline(const sf::Vector2f* points, std::size_t count, float thickness, sf::Color color) {
+        if (count > MAX_POLYGON_POINTS) count = MAX_POLYGON_POINTS;
+
+        sf::Vector2f center;
+        for (std::size_t i = 0; i < count; ++i) {
+            center += points[i];
+        }
+        center = center * (1.0f / count);
+
+        std::array<sf::Vector2f, MAX_POLYGON_POINTS> outer;
+        for (std::size_t i = 0; i < count; ++i) {
+            sf::Vector2f p0 = points[(i + count - 1) % count];
+            sf::Vector2f p1 = points[i];
+            sf::Vector2f p2 = points[(i + 1) % count];
+
+            sf::Vector2f n1 = edgeNormal(p0, p1);
+            sf::Vector2f n2 = edgeNormal(p1, p2);
+
+            // Las normales deben apuntar hacia afuera del polígono
+            sf::Vector2f toPoint = p1 - center;
+            if (n1.x * toPoint.x + n1.y * toPoint.y < 0) n1 = -n1;
+            if (n2.x * toPoint.x + n2.y * toPoint.y < 0) n2 = -n2;
+
+            float factor = 1.0f + (n1.x * n2.x + n1.y * n2.y);
+            sf::Vector2f normal = (n1 + n2) * (1.0f / factor);
+            outer[i] = p1 + normal * thickness;
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            std::size_t next = (i + 1) % count;
+            addTriangle(points[i], outer[i], points[next], color);
+            addTriangle(points[next], outer[i], outer[next], color);
+        }
+    }
+
+    static sf::Vector2f edgeNormal(sf::Vector2f from, sf::Vector2f to) {
+        sf::Vector2f normal(from.y - to.y, to.x - from.x);
+        float length = std::sqrt(normal.x * normal.x + normal.y * normal.y);
+        if (length != 0.0f) {
+            normal = normal * (1.0f / length);
+        }
+        return normal;
+    }
+
+    // Senos y cosenos por cantidad de puntos, calculados la primera vez que se usan
+    const std::vector<sf::Vector2f>& unitCircle(std::size_t pointCount) {
+        std::vector<sf::Vector2f>& unit = unitCircles[pointCount];
+        if (unit.empty()) {
+            unit.resize(pointCount);
+            for (std::size_t i = 0; i < pointCount; ++i) {
+                // Igual que sf::CircleShape: el primer punto queda arriba
+                float angle = i * 2.0f * 3.14159265f / pointCount - 3.14159265f / 2.0f;
+                unit[i] = sf::Vector2f(std::cos(angle), std::sin(angle));
+            }
+        }
+        return unit;
+    }
+
+    sf::VertexArray vertices;
+    std::array<sf::Vector2f, MAX_POLYGON_POINTS> scratch;
+    std::array<std::vector<sf::Vector2f>, MAX_POLYGON_POINTS + 1> unitCircles;
+};
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+#include "FrameProfiler.hpp"
+#include "PrimitiveBatch.hpp"
+
+// Panel de diagnóstico sobre el juego: ms promedio de cada fase, histograma
+// de duración de frames, draw calls y entidades. Los números se leen del
+// historial de FrameProfiler; el texto se re-arma cada REFRESH_FRAMES frames
+// para que el propio overlay casi no cueste.
+class ProfilerOverlay {
+public:
+    static const std::size_t AVERAGE_FRAMES = 60;
+    static const std::uint64_t REFRESH_FRAMES = 15;
+    static const std::size_t HISTOGRAM_BINS = 17;          // Columnas de 2 ms; la última junta todo lo que pase de 32 ms
+    static constexpr float BIN_MS = 2.0f;
+
+    ProfilerOverlay(const sf::Font& font, sf::Vector2f position)
+        : position(position), text(font, "", 14) {
+        text.setFillColor(sf::Color::White);
+        text.setPosition(sf::Vector2f(position.x + PADDING, position.y + PADDING));
+    }
+
+    void toggle() {
+        visible = !visible;
+        lastRefresh = 0;
+    }
+
+    bool isVisible() const {
+        return visible;
+    }
+
+    // Mensaje extra al pie del panel (por ejemplo, dónde se guardó la traza)
+    void setStatus(const std::string& message) {
+        status = message;
+        lastRefresh = 0;
+    }
+
+    // Retorna las llamadas de dibujo hechas (0 si está oculto)
+    std::size_t draw(sf::RenderTarget& target, const FrameProfiler& profiler) {
+        if (!visible || profiler.getHistorySize() == 0) {
+            return 0;
+        }
+        if (lastRefresh == 0 || profiler.getFrameCount() - lastRefresh >= REFRESH_FRAMES) {
+            refresh(profiler);
+            lastRefresh = profiler.getFrameCount();
+        }
+
+        batch.rect(position, sf::Vector2f(PANEL_WIDTH, panelHeight), sf::Color(0, 0, 0, 170));
+        float chartLeft = position.x + PADDING;
+        float chartBottom = position.y + panelHeight - PADDING;
+        float barWidth = (PANEL_WIDTH - 2 * PADDING) / HISTOGRAM_BINS;
+        for (std::size_t bin = 0; bin < HISTOGRAM_BINS; ++bin) {
+            if (binCounts[bin] == 0) {
+                continue;
+            }
+            float height = CHART_HEIGHT * binCounts[bin] / static_cast<float>(maxBinCount);
+            float binEndMs = (bin + 1) * BIN_MS;
+            sf::Color color = binEndMs <= 17.0f ? sf::Color(80, 220, 80)
+                            : binEndMs <= 34.0f ? sf::Color(230, 200, 60) : sf::Color(230, 70, 60);
+            batch.rect(sf::Vector2f(chartLeft + bin * barWidth + 1, chartBottom - height),
+                       sf::Vector2f(barWidth - 2, height), color);
+        }
+        // Marca de 16.7 ms (60 FPS)
+        float budgetX = chartLeft + barWidth * (16.7f / BIN_MS);
+        batch.rect(sf::Vector2f(budgetX, chartBottom - CHART_HEIGHT), sf::Vector2f(1, CHART_HEIGHT), sf::Color(255, 255, 255, 140));
+
+        batch.flush(target);
+        target.draw(text);
+        return 2;
+    }
+
+private:
+    static constexpr float PANEL_WIDTH = 260.0f;
+    static constexpr float PADDING = 8.0f;
+    static constexpr float CHART_HEIGHT = 50.0f;
+
+    void refresh(const FrameProfiler& profiler) {
+        std::size_t frames = std::min(AVERAGE_FRAMES, profiler.getHistorySize());
+        std::array<double, PROFILE_PHASE_COUNT> averageMs{};
+        double worstMs = 0.0;
+        for (std::size_t f = 0; f < frames; ++f) {
+            const FrameStats& stats = profiler.getFrame(f);
+            for (std::size_t p = 0; p < PROFILE_PHASE_COUNT; ++p) {
+                averageMs[p] += stats.phaseNs[p] / 1e6;
+            }
+            worstMs = std::max(worstMs, stats.phaseNs[0] / 1e6);
+        }
+        for (double& ms : averageMs) {
+            ms /= frames;
+        }
+
+        const FrameStats& last = profiler.getFrame(0);
+        char line[96];
+        std::string lines;
+        std::snprintf(line, sizeof(line), "Frame %.2f ms (max %.2f)  %.0f FPS\n",
+                      averageMs[0], worstMs, averageMs[0] > 0.0 ? 1000.0 / averageMs[0] : 0.0);
+        lines += line;
+        for (std::size_t p = 1; p < PROFILE_PHASE_COUNT; ++p) {
+            std::snprintf(line, sizeof(line), "  %-10s %6.3f ms\n", getProfilePhaseName(static_cast<ProfilePhase>(p)), averageMs[p]);
+            lines += line;
+        }
+        std::snprintf(line, sizeof(line), "Draw calls: %u  Entidades: %u\n", last.drawCalls, last.entities);
+        lines += line;
+        if (!status.empty()) {
+            lines += status + "\n";
+        }
+        text.setString(lines);
+
+        // Histograma de todo el historial
+        binCounts.fill(0);
+        for (std::size_t f = 0; f < profiler.getHistorySize(); ++f) {
+            double ms = profiler.getFrame(f).phaseNs[0] / 1e6;
+            std::size_t bin = std::min(HISTOGRAM_BINS - 1, static_cast<std::size_t>(ms / BIN_MS));
+            ++binCounts[bin];
+        }
+        maxBinCount = std::max<std::size_t>(1, *std::max_element(binCounts.begin(), binCounts.end()));
+
+        panelHeight = text.getLocalBounds().size.y + text.getLocalBounds().position.y + CHART_HEIGHT + 3 * PADDING;
+    }
+
+    sf::Vector2f position;
+    sf::Text text;
+    PrimitiveBatch batch;
+    std::string status;
+    std::array<std::size_t, HISTOGRAM_BINS> binCounts{};
+    std::size_t maxBinCount = 1;
+    float panelHeight = 0.0f;
+    std::uint64_t lastRefresh = 0;
+    bool visible = false;
+};
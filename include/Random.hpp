@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+
+// SplitMix64: se usa solo para expandir una semilla de 64 bits al estado de
+// Xoshiro128 y para derivar semillas independientes.
+inline std::uint64_t splitMix64(std::uint64_t& state) {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// Semilla de un subsistema (spawn, enemigos, partículas...) a partir de la
+// semilla de la partida. Cada subsistema tiene su propio generador, así que
+// cambiar cuántos números pide uno no altera la secuencia de los demás.
+inline std::uint64_t deriveSeed(std::uint64_t seed, std::uint64_t stream) {
+    std::uint64_t state = seed ^ (stream * 0xD1B54A32D192ED03ull);
+    return splitMix64(state);
+}
+
+// Generador xoshiro128** (Blackman y Vigna): 128 bits de estado, números de
+// 32 bits, sin estado global. La misma semilla da la misma secuencia en
+// cualquier plataforma, a diferencia de rand().
+class Xoshiro128 {
+public:
+    explicit Xoshiro128(std::uint64_t seedValue = 0) {
+        seed(seedValue);
+    }
+
+    void seed(std::uint64_t value) {
+        std::uint64_t state = value;
+        std::uint64_t a = splitMix64(state);
+        std::uint64_t b = splitMix64(state);
+        s[0] = static_cast<std::uint32_t>(a);
+        s[1] = static_cast<std::uint32_t>(a >> 32);
+        s[2] = static_cast<std::uint32_t>(b);
+        s[3] = static_cast<std::uint32_t>(b >> 32);
+    }
+
+    std::uint32_t next() {
+        std::uint32_t result = rotl(s[1] * 5, 7) * 9;
+        std::uint32_t t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 11);
+        return result;
+    }
+
+    // Entero en [0, bound). Multiplicación en lugar de módulo: sin división y
+    // con un sesgo despreciable para los rangos chicos que usa el juego.
+    std::uint32_t nextInt(std::uint32_t bound) {
+        return static_cast<std::uint32_t>((static_cast<std::uint64_t>(next()) * bound) >> 32);
+    }
+
+    // Float en [0, 1)
+    float nextFloat() {
+        return (next() >> 8) * (1.0f / 16777216.0f);
+    }
+
+private:
+    static std::uint32_t rotl(std::uint32_t x, int k) {
+        return (x << k) | (x >> (32 - k));
+    }
+
+    std::uint32_t s[4];
+};
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <SFML/Audio.hpp>
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "AssetLoader.hpp"
+
+// Estadísticas de carga de un caché
+struct ResourceStats {
+    std::size_t loads = 0;      // Lecturas de disco exitosas
+    std::size_t hits = 0;       // Pedidos resueltos sin tocar el disco
+    std::size_t failures = 0;   // Archivos que no se pudieron cargar
+    std::size_t released = 0;   // Recursos liberados con releaseUnused()
+    double loadSeconds = 0.0;   // Tiempo total gastado cargando
+};
+
+inline bool loadResource(sf::Texture& texture, const std::string& path) {
+    return texture.loadFromFile(path);
+}
+
+inline bool loadResource(sf::Font& font, const std::string& path) {
+    return font.openFromFile(path);
+}
+
+inline bool loadResource(sf::SoundBuffer& buffer, const std::string& path) {
+    return buffer.loadFromFile(path);
+}
+
+// Caché de recursos con conteo de referencias, indexado por ruta. El primer
+// get() carga desde disco y los siguientes comparten el mismo objeto. El caché
+// conserva su propia referencia, así que volver a una pantalla no vuelve a
+// leer nada; releaseUnused() libera lo que ya nadie está usando.
+// Si la carga falla se retorna nullptr (y se vuelve a intentar la próxima vez).
+template <class Resource>
+class ResourceCache {
+public:
+    using Handle = std::shared_ptr<Resource>;
+
+    Handle get(const std::string& path) {
+        return get(path, [&](Resource& resource) {
+            return loadResource(resource, path);
+        });
+    }
+
+    // Igual que get(path) pero con una función de carga propia (por ejemplo,
+    // para armar un atlas a partir de varios archivos)
+    template <class Loader>
+    Handle get(const std::string& key, Loader&& loader) {
+        auto found = entries.find(key);
+        if (found != entries.end()) {
+            ++stats.hits;
+            return found->second;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        Handle resource = std::make_shared<Resource>();
+        bool loaded = loader(*resource);
+        stats.loadSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if (!loaded) {
+            ++stats.failures;
+            return nullptr;
+        }
+
+        ++stats.loads;
+        entries.emplace(key, resource);
+        return resource;
+    }
+
+    // Registra un recurso cargado por fuera del caché (por ejemplo con
+    // AssetLoader en segundo plano) para que desde ahí se comparta y se libere
+    // como los demás. Si la clave ya estaba se conserva el existente; con
+    // resource nulo solo se retorna lo que haya.
+    Handle adopt(const std::string& key, Handle resource) {
+        auto found = entries.find(key);
+        if (found != entries.end()) {
+            ++stats.hits;
+            return found->second;
+        }
+        if (!resource) {
+            return nullptr;
+        }
+        ++stats.loads;
+        entries.emplace(key, resource);
+        return resource;
+    }
+
+    // Libera los recursos que solo el caché está sosteniendo
+    std::size_t releaseUnused() {
+        std::size_t count = 0;
+        for (auto it = entries.begin(); it != entries.end();) {
+            if (it->second.use_count() == 1) {
+                it = entries.erase(it);
+                ++count;
+            } else {
+                ++it;
+            }
+        }
+        stats.released += count;
+        return count;
+    }
+
+    void clear() {
+        entries.clear();
+    }
+
+    std::size_t size() const {
+        return entries.size();
+    }
+
+    const ResourceStats& getStats() const {
+        return stats;
+    }
+
+    // Recurso vacío para cuando un objeto SFML necesita una referencia aunque
+    // la carga haya fallado. Vive con el caché, así que se destruye junto con
+    // los demás recursos (antes que la ventana) y no al salir del programa.
+    const Resource& placeholder() const {
+        return placeholderResource;
+    }
+
+private:
+    std::map<std::string, Handle> entries;
+    ResourceStats stats;
+    Resource placeholderResource;
+};
+
+inline void printResourceStats(std::ostream& out, const char* name, const ResourceStats& stats) {
+    out << name << ": " << stats.loads << " cargas, " << stats.hits << " aciertos, "
+        << stats.failures << " fallos, " << stats.released << " liberados, "
+        << static_cast<int>(stats.loadSeconds * 1000.0) << " ms cargando\n";
+}
+
+// Cachés compartidos por todas las pantallas de un juego, más el cargador en
+// segundo plano (las pantallas llaman loader.update() una vez por frame)
+struct GameResources {
+    ResourceCache<sf::Texture> textures;
+    ResourceCache<sf::Font> fonts;
+    ResourceCache<sf::SoundBuffer> sounds;
+    AssetLoader loader;
+
+    // Libera lo que ninguna pantalla está usando. Se llama al pasar de los
+    // menús al juego: lo que sostiene main (fuente y fondo de los menús) sigue
+    // cargado, lo que solo usó la selección de personaje o una partida
+    // anterior se libera.
+    std::size_t releaseUnused() {
+        return textures.releaseUnused() + fonts.releaseUnused() + sounds.releaseUnused();
+    }
+
+    void printStats(std::ostream& out) const {
+        printResourceStats(out, "Texturas", textures.getStats());
+        printResourceStats(out, "Fuentes", fonts.getStats());
+        printResourceStats(out, "Sonidos", sounds.getStats());
+    }
+};
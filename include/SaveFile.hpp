@@ -0,0 +1,353 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Archivo de guardado binario:
+//   "PKSV" | versión u16 | largo de los datos u32 | CRC-32 de los datos u32 | datos
+// Todos los enteros van en little-endian. El CRC detecta archivos cortados o
+// dañados; la versión permite cambiar el formato de los datos más adelante.
+const char SAVE_MAGIC[4] = {'P', 'K', 'S', 'V'};
+const std::size_t SAVE_HEADER_SIZE = 14;
+
+// CRC-32 (IEEE 802.3), la tabla se calcula la primera vez
+inline std::uint32_t crc32(const std::uint8_t* data, std::size_t size) {
+    static const std::array<std::uint32_t, 256> table = [] {
+        std::array<std::uint32_t, 256> values{};
+        for (std::uint32_t i = 0; i < 256; ++i) {
+            std::uint32_t c = i;
+            for (int bit = 0; bit < 8; ++bit) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            values[i] = c;
+        }
+        return values;
+    }();
+
+    std::uint32_t crc = 0xFFFFFFFFu;
+    for (std::size_t i = 0; i < size; ++i) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+// Serializa valores en little-endian
+class ByteWriter {
+public:
+    void u8(std::uint8_t value) {
+        bytes.push_back(value);
+    }
+
+    void u16(std::uint16_t value) {
+        u8(static_cast<std::uint8_t>(value));
+        u8(static_cast<std::uint8_t>(value >> 8));
+    }
+
+    void u32(std::uint32_t value) {
+        u16(static_cast<std::uint16_t>(value));
+        u16(static_cast<std::uint16_t>(value >> 16));
+    }
+
+    void u64(std::uint64_t value) {
+        u32(static_cast<std::uint32_t>(value));
+        u32(static_cast<std::uint32_t>(value >> 32));
+    }
+
+    void i32(std::int32_t value) {
+        u32(static_cast<std::uint32_t>(value));
+    }
+
+    // Entero de largo variable (LEB128): 7 bits por byte, 1 byte hasta 127
+    void varint(std::uint32_t value) {
+        while (value >= 0x80) {
+            u8(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        u8(static_cast<std::uint8_t>(value));
+    }
+
+    void f32(float value) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        u32(bits);
+    }
+
+    // Texto corto: largo u8 y los bytes (se corta en 255)
+    void string(const std::string& value) {
+        std::size_t size = std::min<std::size_t>(value.size(), 255);
+        u8(static_cast<std::uint8_t>(size));
+        bytes.insert(bytes.end(), value.begin(), value.begin() + size);
+    }
+
+    const std::vector<std::uint8_t>& getBytes() const {
+        return bytes;
+    }
+
+private:
+    std::vector<std::uint8_t> bytes;
+};
+
+// Lee lo que escribió ByteWriter. Si los datos se acaban, isOk() pasa a
+// false y todo lo que sigue lee ceros.
+class ByteReader {
+public:
+    ByteReader(const std::vector<std::uint8_t>& bytes) : bytes(bytes) {}
+
+    std::uint8_t u8() {
+        if (position >= bytes.size()) {
+            ok = false;
+            return 0;
+        }
+        return bytes[position++];
+    }
+
+    std::uint16_t u16() {
+        std::uint16_t low = u8();
+        return static_cast<std::uint16_t>(low | (u8() << 8));
+    }
+
+    std::uint32_t u32() {
+        std::uint32_t low = u16();
+        return low | (static_cast<std::uint32_t>(u16()) << 16);
+    }
+
+    std::uint64_t u64() {
+        std::uint64_t low = u32();
+        return low | (static_cast<std::uint64_t>(u32()) << 32);
+    }
+
+    std::int32_t i32() {
+        return static_cast<std::int32_t>(u32());
+    }
+
+    std::uint32_t varint() {
+        std::uint32_t value = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            std::uint8_t byte = u8();
+            value |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return value;
+            }
+        }
+        ok = false; // Más de 5 bytes: datos dañados
+        return 0;
+    }
+
+    float f32() {
+        std::uint32_t bits = u32();
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    std::string string() {
+        std::size_t size = u8();
+        if (position + size > bytes.size()) {
+            ok = false;
+            position = bytes.size();
+            return std::string();
+        }
+        std::string value(bytes.begin() + position, bytes.begin() + position + size);
+        position += size;
+        return value;
+    }
+
+    bool isOk() const {
+        return ok;
+    }
+
+    bool atEnd() const {
+        return position == bytes.size();
+    }
+
+private:
+    const std::vector<std::uint8_t>& bytes;
+    std::size_t position = 0;
+    bool ok = true;
+};
+
+enum class SaveFileStatus {
+    OK,
+    NOT_A_SAVE_FILE,    // No empieza con la firma (por ejemplo, el formato de texto anterior)
+    CORRUPT             // Firma correcta pero cortado o con CRC distinto
+};
+
+// Arma el archivo completo (cabecera + datos)
+inline std::vector<std::uint8_t> packSaveFile(std::uint16_t version, const std::vector<std::uint8_t>& payload) {
+    ByteWriter header;
+    for (char c : SAVE_MAGIC) {
+        header.u8(static_cast<std::uint8_t>(c));
+    }
+    header.u16(version);
+    header.u32(static_cast<std::uint32_t>(payload.size()));
+    header.u32(crc32(payload.data(), payload.size()));
+
+    std::vector<std::uint8_t> file = header.getBytes();
+    file.insert(file.end(), payload.begin(), payload.end());
+    return file;
+}
+
+// Valida firma, largo y CRC y separa la versión y los datos
+inline SaveFileStatus unpackSaveFile(const std::vector<std::uint8_t>& file, std::uint16_t& version,
+                                     std::vector<std::uint8_t>& payload) {
+    if (file.size() < sizeof(SAVE_MAGIC) || std::memcmp(file.data(), SAVE_MAGIC, sizeof(SAVE_MAGIC)) != 0) {
+        return SaveFileStatus::NOT_A_SAVE_FILE;
+    }
+    if (file.size() < SAVE_HEADER_SIZE) {
+        return SaveFileStatus::CORRUPT;
+    }
+
+    ByteReader header(file);
+    for (std::size_t i = 0; i < sizeof(SAVE_MAGIC); ++i) {
+        header.u8();
+    }
+    version = header.u16();
+    std::uint32_t size = header.u32();
+    std::uint32_t checksum = header.u32();
+
+    if (file.size() - SAVE_HEADER_SIZE != size) {
+        return SaveFileStatus::CORRUPT;
+    }
+    if (crc32(file.data() + SAVE_HEADER_SIZE, size) != checksum) {
+        return SaveFileStatus::CORRUPT;
+    }
+
+    payload.assign(file.begin() + SAVE_HEADER_SIZE, file.end());
+    return SaveFileStatus::OK;
+}
+
+inline bool readWholeFile(const std::string& path, std::vector<std::uint8_t>& bytes) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return !file.bad();
+}
+
+// Escribe en "<path>.tmp" y recién al terminar lo renombra sobre path. Si el
+// juego se cierra a mitad de la escritura, el archivo anterior queda intacto.
+inline bool writeFileAtomic(const std::string& path, const std::vector<std::uint8_t>& bytes) {
+    std::string tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        file.flush();
+        if (!file) {
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, path, error);
+    return !error;
+}
+
+// Escritor en segundo plano: save() solo copia los bytes y vuelve; un hilo
+// propio los escribe con writeFileAtomic(). Si llegan varios guardados del
+// mismo archivo antes de escribir, solo se escribe el último. Al destruirse
+// escribe lo pendiente, así que cerrar el juego no pierde el último guardado.
+class SaveWriter {
+public:
+    SaveWriter() : worker([this] { run(); }) {}
+
+    ~SaveWriter() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wakeUp.notify_one();
+        worker.join();
+    }
+
+    SaveWriter(const SaveWriter&) = delete;
+    SaveWriter& operator=(const SaveWriter&) = delete;
+
+    void save(const std::string& path, std::vector<std::uint8_t> bytes) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            bool replaced = false;
+            for (auto& request : pending) {
+                if (request.first == path) {
+                    request.second = std::move(bytes);
+                    replaced = true;
+                    break;
+                }
+            }
+            if (!replaced) {
+                pending.emplace_back(path, std::move(bytes));
+            }
+        }
+        wakeUp.notify_one();
+    }
+
+    // Espera a que todo lo pedido hasta ahora esté en disco
+    void flush() {
+        std::unique_lock<std::mutex> lock(mutex);
+        idle.wait(lock, [this] { return pending.empty() && !writing; });
+    }
+
+    // Escrituras que fallaron (disco lleno, sin permisos...)
+    std::size_t getFailureCount() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return failures;
+    }
+
+private:
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            wakeUp.wait(lock, [this] { return stopping || !pending.empty(); });
+            if (pending.empty()) {
+                return; // stopping y nada pendiente
+            }
+
+            std::pair<std::string, std::vector<std::uint8_t>> request = std::move(pending.front());
+            pending.erase(pending.begin());
+            writing = true;
+
+            lock.unlock();
+            bool written = writeFileAtomic(request.first, request.second);
+            lock.lock();
+
+            writing = false;
+            if (!written) {
+                ++failures;
+            }
+            if (pending.empty()) {
+                idle.notify_all();
+            }
+        }
+    }
+
+    mutable std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::condition_variable idle;
+    std::vector<std::pair<std::string, std::vector<std::uint8_t>>> pending;
+    bool writing = false;
+    bool stopping = false;
+    std::size_t failures = 0;
+    std::thread worker;
+};
+
+// Escritor compartido por todo el programa; se crea en el primer uso y al
+// salir del programa escribe lo que haya quedado pendiente
+inline SaveWriter& getSaveWriter() {
+    static SaveWriter writer;
+    return writer;
+}
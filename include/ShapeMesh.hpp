@@ -0,0 +1,49 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+
+#include "PrimitiveBatch.hpp"
+
+// Figura compuesta (un dino hecho de rectángulos, una nube de círculos...)
+// teselada una sola vez en coordenadas locales. Se arma con las primitivas de
+// PrimitiveBatch y después solo se desplaza: sola se dibuja con una llamada y
+// una transformación, y con addTo() se copia en un PrimitiveBatch para que
+// todas las instancias de una capa salgan en una sola llamada de dibujo.
+//
+// Se usa una malla por pose o cuadro de animación, construidas al arrancar:
+// en el juego no se crean figuras por frame.
+class ShapeMesh {
+public:
+    ShapeMesh() : vertices(sf::PrimitiveType::Triangles) {}
+
+    // Reemplaza la malla por lo acumulado en builder y lo vacía
+    void bake(PrimitiveBatch& builder) {
+        vertices = builder.getVertices();
+        builder.clear();
+        bounds = vertices.getBounds();
+    }
+
+    void draw(sf::RenderTarget& target, sf::Vector2f position) const {
+        sf::RenderStates states;
+        states.transform.translate(position);
+        target.draw(vertices, states);
+    }
+
+    void addTo(PrimitiveBatch& batch, sf::Vector2f position) const {
+        batch.append(vertices, position);
+    }
+
+    // Rectángulo que ocupa en coordenadas locales (contornos incluidos)
+    sf::FloatRect getBounds() const {
+        return bounds;
+    }
+
+    std::size_t getVertexCount() const {
+        return vertices.getVertexCount();
+    }
+
+private:
+    sf::VertexArray vertices;
+    sf::FloatRect bounds;
+};
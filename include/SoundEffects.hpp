@@ -0,0 +1,212 @@
+#pragma once
+
+#include <SFML/Audio.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+// Efecto registrado en el pool: buffer ya decodificado y reglas de mezcla
+struct SoundEffect {
+    std::shared_ptr<const sf::SoundBuffer> buffer;
+    int priority = 0;       // Una voz solo se le roba a un efecto de prioridad menor o igual
+    int maxVoices = 0;      // Instancias simultáneas de este efecto (0 = sin límite)
+    float volume = 100.0f;  // Relativo al volumen general del pool (0-100)
+    sf::Time maxDuration;   // Cada instancia se corta al llegar a este largo (cero = el buffer entero)
+};
+
+// Pool fijo de voces para efectos cortos. Los buffers se decodifican una sola
+// vez al cargar y cada disparo es una instancia independiente, sin tocar el
+// disco ni arrancar un decodificador.
+//
+// Durante el frame se llama trigger() (no reproduce nada todavía); update()
+// procesa la cola una vez por frame. Dos pedidos del mismo efecto en el mismo
+// frame se reproducen una sola vez. Si no hay voces libres se roba la de menor
+// prioridad y, a igual prioridad, la más vieja.
+template <std::size_t Voices>
+class SoundEffectPool {
+public:
+    static const std::size_t MAX_TRIGGERS_PER_FRAME = 16;
+
+    // Registra un efecto y retorna su id (-1 si no hay buffer)
+    int addEffect(std::shared_ptr<const sf::SoundBuffer> buffer, int priority = 0, int maxVoices = 0, float volume = 100.0f) {
+        if (!buffer) {
+            return -1;
+        }
+        effects.push_back(SoundEffect{std::move(buffer), priority, maxVoices, volume, sf::Time::Zero});
+        return static_cast<int>(effects.size() - 1);
+    }
+
+    // Recorta las instancias de un efecto, por ejemplo un disparo grabado
+    // como ráfaga larga al tiempo entre disparos. Ids inválidos se ignoran.
+    void setMaxDuration(int effect, sf::Time duration) {
+        if (effect >= 0 && effect < static_cast<int>(effects.size())) {
+            effects[effect].maxDuration = duration;
+        }
+    }
+
+    // Encola un efecto para este frame. Ids inválidos se ignoran.
+    void trigger(int effect, float pitch = 1.0f) {
+        if (effect < 0 || effect >= static_cast<int>(effects.size())) {
+            return;
+        }
+        for (std::size_t i = 0; i < triggerCount; ++i) {
+            if (triggers[i].effect == effect) {
+                return;
+            }
+        }
+        if (triggerCount < MAX_TRIGGERS_PER_FRAME) {
+            triggers[triggerCount++] = Trigger{effect, pitch};
+        }
+    }
+
+    // Corta las instancias que pasaron su largo y reproduce lo encolado en el frame
+    void update() {
+        for (std::size_t v = 0; v < Voices; ++v) {
+            if (isBusy(v) && effects[owner[v]].maxDuration > sf::Time::Zero &&
+                voices[v]->getPlayingOffset() >= effects[owner[v]].maxDuration) {
+                voices[v]->stop();
+            }
+        }
+        for (std::size_t i = 0; i < triggerCount; ++i) {
+            start(triggers[i]);
+        }
+        triggerCount = 0;
+    }
+
+    // Volumen general 0-100 (por ejemplo, sfxVolume de la configuración)
+    void setVolume(float newVolume) {
+        masterVolume = newVolume;
+        for (std::size_t v = 0; v < Voices; ++v) {
+            if (voices[v] && owner[v] >= 0) {
+                voices[v]->setVolume(effects[owner[v]].volume * masterVolume / 100.0f);
+            }
+        }
+    }
+
+    void pauseAll() {
+        for (std::size_t v = 0; v < Voices; ++v) {
+            if (voices[v] && voices[v]->getStatus() == sf::SoundSource::Status::Playing) {
+                voices[v]->pause();
+            }
+        }
+    }
+
+    void resumeAll() {
+        for (std::size_t v = 0; v < Voices; ++v) {
+            if (voices[v] && voices[v]->getStatus() == sf::SoundSource::Status::Paused) {
+                voices[v]->play();
+            }
+        }
+    }
+
+    void stopAll() {
+        for (std::size_t v = 0; v < Voices; ++v) {
+            if (voices[v]) {
+                voices[v]->stop();
+            }
+        }
+        triggerCount = 0;
+    }
+
+    // Voces sonando o en pausa
+    std::size_t getActiveVoiceCount() const {
+        std::size_t count = 0;
+        for (std::size_t v = 0; v < Voices; ++v) {
+            if (isBusy(v)) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    // Veces que una voz se cortó para dar lugar a otra
+    std::uint64_t getStolenCount() const {
+        return stolen;
+    }
+
+private:
+    struct Trigger {
+        int effect;
+        float pitch;
+    };
+
+    bool isBusy(std::size_t v) const {
+        return voices[v] && voices[v]->getStatus() != sf::SoundSource::Status::Stopped;
+    }
+
+    void start(const Trigger& request) {
+        const SoundEffect& effect = effects[request.effect];
+        std::size_t voice = chooseVoice(request.effect, effect);
+        if (voice == Voices) {
+            return; // Todas las voces tienen más prioridad
+        }
+
+        if (isBusy(voice)) {
+            voices[voice]->stop();
+            ++stolen;
+        }
+        if (voices[voice]) {
+            voices[voice]->setBuffer(*effect.buffer);
+        } else {
+            voices[voice].emplace(*effect.buffer);
+        }
+        voices[voice]->setVolume(effect.volume * masterVolume / 100.0f);
+        voices[voice]->setPitch(request.pitch);
+        voices[voice]->play();
+
+        owner[voice] = request.effect;
+        startedAt[voice] = ++startCounter;
+    }
+
+    // Voz libre si hay; si el efecto llegó a su límite, su instancia más vieja;
+    // si no, la de menor prioridad y más vieja. Voices = ninguna disponible.
+    std::size_t chooseVoice(int effectId, const SoundEffect& effect) const {
+        std::size_t oldestSame = Voices;
+        int sameCount = 0;
+        for (std::size_t v = 0; v < Voices; ++v) {
+            if (isBusy(v) && owner[v] == effectId) {
+                ++sameCount;
+                if (oldestSame == Voices || startedAt[v] < startedAt[oldestSame]) {
+                    oldestSame = v;
+                }
+            }
+        }
+        if (effect.maxVoices > 0 && sameCount >= effect.maxVoices) {
+            return oldestSame;
+        }
+
+        std::size_t best = Voices;
+        for (std::size_t v = 0; v < Voices; ++v) {
+            if (!isBusy(v)) {
+                return v;
+            }
+            int voicePriority = effects[owner[v]].priority;
+            if (voicePriority > effect.priority) {
+                continue;
+            }
+            if (best == Voices) {
+                best = v;
+                continue;
+            }
+            int bestPriority = effects[owner[best]].priority;
+            if (voicePriority < bestPriority || (voicePriority == bestPriority && startedAt[v] < startedAt[best])) {
+                best = v;
+            }
+        }
+        return best;
+    }
+
+    std::vector<SoundEffect> effects;
+    std::array<std::optional<sf::Sound>, Voices> voices;
+    std::array<int, Voices> owner{};
+    std::array<std::uint64_t, Voices> startedAt{};
+    std::uint64_t startCounter = 0;
+    std::uint64_t stolen = 0;
+    float masterVolume = 100.0f;
+
+    std::array<Trigger, MAX_TRIGGERS_PER_FRAME> triggers{};
+    std::size_t triggerCount = 0;
+};
@@ -0,0 +1,342 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Empaquetador skyline (bottom-left): el borde superior de lo ya colocado se
+// guarda como una lista de segmentos horizontales y cada rectángulo nuevo se
+// coloca donde su borde inferior quede lo más arriba posible. No depende de SFML.
+class SkylinePacker {
+public:
+    SkylinePacker(unsigned width = 0, unsigned height = 0) {
+        reset(width, height);
+    }
+
+    void reset(unsigned width, unsigned height) {
+        pageWidth = width;
+        pageHeight = height;
+        usedHeight = 0;
+        skyline.clear();
+        skyline.push_back(Segment{0, 0, width});
+    }
+
+    unsigned getUsedHeight() const {
+        return usedHeight;
+    }
+
+    // Busca lugar para un rectángulo de width x height. Si no cabe retorna false.
+    bool insert(unsigned width, unsigned height, unsigned& outX, unsigned& outY) {
+        std::size_t bestIndex = skyline.size();
+        unsigned bestX = 0;
+        unsigned bestY = 0;
+        unsigned bestBottom = ~0u;
+        unsigned bestSegmentWidth = ~0u;
+
+        for (std::size_t i = 0; i < skyline.size(); ++i) {
+            unsigned y;
+            if (!fits(i, width, height, y)) {
+                continue;
+            }
+            unsigned bottom = y + height;
+            if (bottom < bestBottom || (bottom == bestBottom && skyline[i].width < bestSegmentWidth)) {
+                bestIndex = i;
+                bestX = skyline[i].x;
+                bestY = y;
+                bestBottom = bottom;
+                bestSegmentWidth = skyline[i].width;
+            }
+        }
+
+        if (bestIndex == skyline.size()) {
+            return false;
+        }
+
+        addSegment(bestIndex, bestX, bestY + height, width);
+        usedHeight = std::max(usedHeight, bestY + height);
+        outX = bestX;
+        outY = bestY;
+        return true;
+    }
+
+private:
+    struct Segment {
+        unsigned x;
+        unsigned y;
+        unsigned width;
+    };
+
+    // Altura a la que quedaría el rectángulo si empieza en el segmento 'index'
+    bool fits(std::size_t index, unsigned width, unsigned height, unsigned& outY) const {
+        unsigned x = skyline[index].x;
+        if (x + width > pageWidth) {
+            return false;
+        }
+
+        unsigned y = 0;
+        unsigned remaining = width;
+        for (std::size_t i = index; remaining > 0; ++i) {
+            y = std::max(y, skyline[i].y);
+            if (y + height > pageHeight) {
+                return false;
+            }
+            remaining -= std::min(remaining, skyline[i].width);
+        }
+        outY = y;
+        return true;
+    }
+
+    // Inserta el segmento nuevo y recorta los que quedaron debajo
+    void addSegment(std::size_t index, unsigned x, unsigned y, unsigned width) {
+        skyline.insert(skyline.begin() + index, Segment{x, y, width});
+
+        unsigned right = x + width;
+        for (std::size_t i = index + 1; i < skyline.size();) {
+            Segment& segment = skyline[i];
+            if (segment.x >= right) {
+                break;
+            }
+            unsigned segmentRight = segment.x + segment.width;
+            if (segmentRight <= right) {
+                skyline.erase(skyline.begin() + i);
+            } else {
+                segment.width = segmentRight - right;
+                segment.x = right;
+                break;
+            }
+        }
+
+        // Unir segmentos vecinos a la misma altura
+        for (std::size_t i = 0; i + 1 < skyline.size();) {
+            if (skyline[i].y == skyline[i + 1].y) {
+                skyline[i].width += skyline[i + 1].width;
+                skyline.erase(skyline.begin() + i + 1);
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    unsigned pageWidth = 0;
+    unsigned pageHeight = 0;
+    unsigned usedHeight = 0;
+    std::vector<Segment> skyline;
+};
+
+enum class UploadStatus {
+    IN_PROGRESS,
+    DONE,
+    FAILED
+};
+
+// Sube una imagen a una textura de a franjas de filas completas, empezando en
+// nextRow y gastando como máximo byteBudget bytes (siempre al menos una fila
+// si queda presupuesto). Así una textura grande se reparte entre varios
+// frames en lugar de congelar uno solo.
+inline UploadStatus uploadImageRows(sf::Texture& texture, const sf::Image& image, unsigned& nextRow, std::size_t& byteBudget) {
+    sf::Vector2u size = image.getSize();
+    if (nextRow == 0 && texture.getSize() != size) {
+        if (!texture.resize(size)) {
+            return UploadStatus::FAILED;
+        }
+    }
+    if (nextRow >= size.y) {
+        return UploadStatus::DONE;
+    }
+    if (byteBudget == 0) {
+        return UploadStatus::IN_PROGRESS;
+    }
+
+    std::size_t rowBytes = static_cast<std::size_t>(size.x) * 4;
+    std::size_t rows = std::max<std::size_t>(1, byteBudget / rowBytes);
+    rows = std::min<std::size_t>(rows, size.y - nextRow);
+
+    texture.update(image.getPixelsPtr() + nextRow * rowBytes, sf::Vector2u(size.x, static_cast<unsigned>(rows)),
+                   sf::Vector2u(0, nextRow));
+    nextRow += static_cast<unsigned>(rows);
+    byteBudget -= std::min(byteBudget, rows * rowBytes);
+
+    return nextRow >= size.y ? UploadStatus::DONE : UploadStatus::IN_PROGRESS;
+}
+
+// Handle de una región del atlas (índice en el orden en que se agregó)
+struct AtlasHandle {
+    static constexpr std::uint16_t INVALID = 0xFFFF;
+
+    std::uint16_t index = INVALID;
+
+    bool isValid() const {
+        return index != INVALID;
+    }
+};
+
+// Región empaquetada: página (textura) y rectángulo dentro de ella
+struct AtlasRegion {
+    std::size_t page = 0;
+    sf::IntRect rect;
+};
+
+// Atlas de texturas armado al cargar. Las hojas de sprites se agregan con
+// add(), build() las empaqueta en una o más páginas y las sube a la GPU, y
+// después cada sprite usa su región (página + sub-rectángulo) en lugar de una
+// textura propia. Las páginas se recortan a la altura realmente usada.
+// build() equivale a pack() (CPU) seguido de upload() (GPU); AssetLoader los
+// corre por separado para armar el atlas en segundo plano.
+class TextureAtlas {
+public:
+    // Separación entre regiones para que el filtrado no mezcle hojas vecinas
+    static const unsigned PADDING = 2;
+
+    // pageSize = 0 usa 2048 o el máximo que soporte la tarjeta si es menor
+    explicit TextureAtlas(unsigned pageSize = 0) : pageSize(pageSize) {}
+
+    // Carga una imagen para empaquetarla. Retorna un handle inválido si falla.
+    AtlasHandle add(const std::string& path) {
+        sf::Image image;
+        if (!image.loadFromFile(path)) {
+            return AtlasHandle{};
+        }
+        pending.push_back(image);
+        regions.push_back(AtlasRegion{});
+        paths.push_back(path);
+        return AtlasHandle{static_cast<std::uint16_t>(regions.size() - 1)};
+    }
+
+    // Empaqueta y sube todo a la GPU de una vez. Retorna false si alguna
+    // imagen no cabe en una página o si falla la subida.
+    bool build() {
+        std::size_t unlimited = ~std::size_t(0);
+        return pack() && upload(unlimited) == UploadStatus::DONE;
+    }
+
+    // Empaqueta todo lo agregado (de mayor a menor lado más largo) y arma las
+    // imágenes de cada página en memoria. Si el atlas se creó con pageSize
+    // distinto de 0 no toca la GPU, así que puede correr en otro hilo.
+    bool pack() {
+        unsigned size = pageSize;
+        if (size == 0) {
+            size = std::min(2048u, sf::Texture::getMaximumSize());
+        }
+
+        std::vector<std::size_t> order(pending.size());
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+            sf::Vector2u sizeA = pending[a].getSize();
+            sf::Vector2u sizeB = pending[b].getSize();
+            return std::max(sizeA.x, sizeA.y) > std::max(sizeB.x, sizeB.y);
+        });
+
+        std::vector<SkylinePacker> packers;
+        for (std::size_t i : order) {
+            sf::Vector2u imageSize = pending[i].getSize();
+            unsigned x = 0, y = 0;
+            std::size_t page = 0;
+            while (page < packers.size() && !packers[page].insert(imageSize.x + PADDING, imageSize.y + PADDING, x, y)) {
+                ++page;
+            }
+            if (page == packers.size()) {
+                packers.emplace_back(size, size);
+                if (!packers.back().insert(imageSize.x + PADDING, imageSize.y + PADDING, x, y)) {
+                    return false; // Más grande que una página completa
+                }
+            }
+            regions[i].page = page;
+            regions[i].rect = sf::IntRect(sf::Vector2i(x, y), sf::Vector2i(imageSize.x, imageSize.y));
+        }
+
+        pageImages.clear();
+        pageImages.resize(packers.size());
+        for (std::size_t page = 0; page < packers.size(); ++page) {
+            pageImages[page].resize(sf::Vector2u(size, packers[page].getUsedHeight()), sf::Color::Transparent);
+            for (std::size_t i = 0; i < regions.size(); ++i) {
+                if (regions[i].page == page) {
+                    if (!pageImages[page].copy(pending[i], sf::Vector2u(regions[i].rect.position))) {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        // Las hojas ya están copiadas en las páginas, no hace falta conservarlas
+        pending.clear();
+        pending.shrink_to_fit();
+        uploadPage = 0;
+        uploadRow = 0;
+        return true;
+    }
+
+    // Sube las páginas empaquetadas a la GPU de a franjas de filas, gastando
+    // como máximo byteBudget bytes (se descuentan de la variable). Se llama una
+    // vez por frame hasta que retorne Done; debe correr en el hilo principal.
+    UploadStatus upload(std::size_t& byteBudget) {
+        if (pages.size() != pageImages.size()) {
+            pages.clear();
+            pages.resize(pageImages.size());
+        }
+
+        while (uploadPage < pageImages.size()) {
+            UploadStatus status = uploadImageRows(pages[uploadPage], pageImages[uploadPage], uploadRow, byteBudget);
+            if (status != UploadStatus::DONE) {
+                return status;
+            }
+            ++uploadPage;
+            uploadRow = 0;
+        }
+
+        // Las páginas ya están en la GPU, no hace falta conservarlas
+        pageImages.clear();
+        pageImages.shrink_to_fit();
+        return UploadStatus::DONE;
+    }
+
+    // Busca una hoja ya agregada por su ruta (handle inválido si no está)
+    AtlasHandle find(const std::string& path) const {
+        for (std::size_t i = 0; i < paths.size(); ++i) {
+            if (paths[i] == path) {
+                return AtlasHandle{static_cast<std::uint16_t>(i)};
+            }
+        }
+        return AtlasHandle{};
+    }
+
+    std::size_t getPageCount() const {
+        return pages.size();
+    }
+
+    const sf::Texture& getPage(std::size_t page) const {
+        return pages[page];
+    }
+
+    const AtlasRegion& getRegion(AtlasHandle handle) const {
+        return regions[handle.index];
+    }
+
+    const sf::Texture& getTexture(AtlasHandle handle) const {
+        return pages[regions[handle.index].page];
+    }
+
+    // Tamaño de la hoja original
+    sf::Vector2u getSize(AtlasHandle handle) const {
+        return sf::Vector2u(regions[handle.index].rect.size);
+    }
+
+    // Convierte un rectángulo relativo a la hoja original en coordenadas de la página
+    sf::IntRect subRect(AtlasHandle handle, const sf::IntRect& local) const {
+        return sf::IntRect(regions[handle.index].rect.position + local.position, local.size);
+    }
+
+private:
+    unsigned pageSize;
+    std::vector<sf::Image> pending;
+    std::vector<AtlasRegion> regions;
+    std::vector<std::string> paths;
+    std::vector<sf::Image> pageImages;
+    std::vector<sf::Texture> pages;
+    std::size_t uploadPage = 0;
+    unsigned uploadRow = 0;
+};
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Handle de un temporizador programado. La generación evita que un handle
+// viejo cancele o consulte un temporizador nuevo que reutilizó la casilla.
+struct TimerHandle {
+    static constexpr std::uint32_t INVALID = 0xFFFFFFFF;
+
+    std::uint32_t index = INVALID;
+    std::uint32_t generation = 0;
+
+    bool isValid() const {
+        return index != INVALID;
+    }
+};
+
+// Rueda de temporizadores jerárquica medida en ticks de simulación (no en
+// tiempo real). Hay LEVELS niveles de SLOTS casillas: el nivel 0 cubre los
+// próximos 64 ticks de a uno, el nivel 1 los próximos 4096 de a 64, y así.
+// Programar y cancelar es O(1); cada tick solo se revisa la casilla actual del
+// nivel 0 y, cada 64 ticks, se reparte una casilla del nivel siguiente hacia
+// abajo. Como el tiempo solo avanza con advance(), pausar el juego (no llamar
+// advance) congela todos los temporizadores.
+//
+// Los temporizadores no guardan funciones: llevan un código de evento y un
+// dato, y advance() se los pasa al callback. La capacidad es fija; no se
+// reserva memoria después de construir la rueda.
+class TimerWheel {
+public:
+    static const std::size_t LEVELS = 4;
+    static const std::size_t SLOT_BITS = 6;
+    static const std::size_t SLOTS = 1 << SLOT_BITS;
+
+    explicit TimerWheel(std::size_t capacity) : nodes(capacity) {
+        clear();
+    }
+
+    // Tick actual (cantidad de advance() desde el último clear())
+    std::uint64_t now() const {
+        return currentTick;
+    }
+
+    std::size_t size() const {
+        return activeCount;
+    }
+
+    // Cancela todo y vuelve al tick 0. Los handles anteriores quedan inválidos.
+    void clear() {
+        for (auto& level : slots) {
+            for (std::uint32_t& head : level) {
+                head = NONE;
+            }
+        }
+        freeHead = NONE;
+        for (std::size_t i = nodes.size(); i-- > 0;) {
+            if (nodes[i].pending) {
+                ++nodes[i].generation;
+                nodes[i].pending = false;
+            }
+            nodes[i].next = freeHead;
+            freeHead = static_cast<std::uint32_t>(i);
+        }
+        currentTick = 0;
+        activeCount = 0;
+    }
+
+    // Programa un evento para dentro de 'delay' ticks (mínimo 1: dispara en el
+    // próximo advance). Retorna un handle inválido si la rueda está llena.
+    TimerHandle schedule(std::uint64_t delay, std::uint16_t event, std::uint32_t data = 0) {
+        if (freeHead == NONE) {
+            return TimerHandle{};
+        }
+        std::uint32_t index = freeHead;
+        Node& node = nodes[index];
+        freeHead = node.next;
+
+        node.deadline = currentTick + (delay == 0 ? 1 : delay);
+        node.event = event;
+        node.data = data;
+        node.pending = true;
+        link(index);
+        ++activeCount;
+        return TimerHandle{index, node.generation};
+    }
+
+    // Retorna false si el temporizador ya había disparado o se había cancelado
+    bool cancel(TimerHandle& handle) {
+        if (!isPending(handle)) {
+            handle = TimerHandle{};
+            return false;
+        }
+        unlink(handle.index);
+        release(handle.index);
+        handle = TimerHandle{};
+        return true;
+    }
+
+    bool isPending(TimerHandle handle) const {
+        return handle.isValid() && handle.index < nodes.size() && nodes[handle.index].pending &&
+               nodes[handle.index].generation == handle.generation;
+    }
+
+    // Ticks que faltan para que dispare (0 si ya no está pendiente)
+    std::uint64_t remaining(TimerHandle handle) const {
+        return isPending(handle) ? nodes[handle.index].deadline - currentTick : 0;
+    }
+
+    // Avanza un tick y llama fire(event, data) por cada temporizador vencido.
+    // Desde fire() se pueden programar temporizadores nuevos (por ejemplo para
+    // repetir uno) y cancelar cualquiera, incluso otro que vence en este mismo
+    // tick: cada temporizador se saca de la casilla y se libera antes de su
+    // llamada, y los que siguen quedan enlazados en la casilla hasta su turno.
+    template <typename Fire>
+    void advance(Fire&& fire) {
+        ++currentTick;
+
+        // Bajar de nivel lo que ahora queda a menos de una vuelta del nivel
+        // inferior, empezando por el nivel más alto
+        for (std::size_t level = LEVELS - 1; level > 0; --level) {
+            std::uint64_t lowMask = (std::uint64_t(1) << (level * SLOT_BITS)) - 1;
+            if ((currentTick & lowMask) == 0) {
+                cascade(level, (currentTick >> (level * SLOT_BITS)) & (SLOTS - 1));
+            }
+        }
+
+        // Un temporizador nuevo nunca cae en la casilla actual (vence al menos
+        // un tick después), así que el ciclo termina
+        std::size_t slot = currentTick & (SLOTS - 1);
+        while (slots[0][slot] != NONE) {
+            std::uint32_t index = slots[0][slot];
+            std::uint16_t event = nodes[index].event;
+            std::uint32_t data = nodes[index].data;
+            unlink(index);
+            release(index);
+            fire(event, data);
+        }
+    }
+
+private:
+    static constexpr std::uint32_t NONE = 0xFFFFFFFF;
+
+    struct Node {
+        std::uint64_t deadline = 0;
+        std::uint32_t next = NONE;
+        std::uint32_t previous = NONE;
+        std::uint32_t generation = 0;
+        std::uint32_t data = 0;
+        std::uint16_t event = 0;
+        std::uint8_t level = 0;
+        std::uint8_t slot = 0;
+        bool pending = false;
+    };
+
+    // El nivel sale del bit más alto en que el vencimiento difiere del tick
+    // actual: así un temporizador del nivel 0 vence exactamente en su casilla
+    void link(std::uint32_t index) {
+        Node& node = nodes[index];
+        std::uint64_t difference = node.deadline ^ currentTick;
+        std::size_t level = 0;
+        while (level + 1 < LEVELS && (difference >> ((level + 1) * SLOT_BITS)) != 0) {
+            ++level;
+        }
+        std::size_t slot = (node.deadline >> (level * SLOT_BITS)) & (SLOTS - 1);
+
+        node.level = static_cast<std::uint8_t>(level);
+        node.slot = static_cast<std::uint8_t>(slot);
+        node.previous = NONE;
+        node.next = slots[level][slot];
+        if (node.next != NONE) {
+            nodes[node.next].previous = index;
+        }
+        slots[level][slot] = index;
+    }
+
+    void unlink(std::uint32_t index) {
+        Node& node = nodes[index];
+        if (node.previous != NONE) {
+            nodes[node.previous].next = node.next;
+        } else {
+            slots[node.level][node.slot] = node.next;
+        }
+        if (node.next != NONE) {
+            nodes[node.next].previous = node.previous;
+        }
+    }
+
+    void release(std::uint32_t index) {
+        Node& node = nodes[index];
+        node.pending = false;
+        ++node.generation;
+        node.next = freeHead;
+        freeHead = index;
+        --activeCount;
+    }
+
+    void cascade(std::size_t level, std::size_t slot) {
+        std::uint32_t index = slots[level][slot];
+        slots[level][slot] = NONE;
+        while (index != NONE) {
+            std::uint32_t next = nodes[index].next;
+            link(index);
+            index = next;
+        }
+    }
+
+    std::vector<Node> nodes;
+    std::uint32_t slots[LEVELS][SLOTS];
+    std::uint32_t freeHead = NONE;
+    std::uint64_t currentTick = 0;
+    std::size_t activeCount = 0;
+};
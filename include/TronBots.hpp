@@ -0,0 +1,241 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "Random.hpp"
+#include "TronCore.hpp"
+
+// Jugadores automáticos de Tron. Cada tick eligen entre los tres movimientos
+// que no son dar la vuelta:
+//   RANDOM      uno al azar que no choque en el tick siguiente
+//   FLOOD_FILL  el que deja más celdas alcanzables (relleno por BFS)
+//   VORONOI     el que maximiza el territorio propio: celdas a las que llega
+//               antes que el rival, menos las que el rival alcanza antes
+//
+// Los buffers de búsqueda se reservan al cambiar el tamaño de la arena y se
+// reutilizan sin limpiarlos entre búsquedas (ver Field). Un TronBot por
+// jugador y por hilo: no comparte estado.
+
+enum class TronBotKind : std::uint8_t {
+    RANDOM,
+    FLOOD_FILL,
+    VORONOI
+};
+
+const int TRON_BOT_KINDS = 3;
+
+inline const char* getTronBotName(TronBotKind kind) {
+    switch (kind) {
+        case TronBotKind::RANDOM: return "random";
+        case TronBotKind::FLOOD_FILL: return "flood";
+        case TronBotKind::VORONOI: return "voronoi";
+    }
+    return "?";
+}
+
+// Retorna false si el nombre no corresponde a ningún bot
+inline bool parseTronBotName(const char* name, TronBotKind& kind) {
+    for (int i = 0; i < TRON_BOT_KINDS; ++i) {
+        if (std::strcmp(name, getTronBotName(static_cast<TronBotKind>(i))) == 0) {
+            kind = static_cast<TronBotKind>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+class TronBot {
+public:
+    explicit TronBot(TronBotKind kind = TronBotKind::VORONOI, std::uint64_t seed = 0)
+        : kind(kind), random(seed) {}
+
+    TronBotKind getKind() const {
+        return kind;
+    }
+
+    void setKind(TronBotKind newKind) {
+        kind = newKind;
+    }
+
+    // Los empates entre movimientos se deciden al azar con esta semilla
+    void seed(std::uint64_t value) {
+        random.seed(value);
+    }
+
+    // Elige la dirección del jugador para el próximo tick y la aplica
+    void think(TronRound& round, int player) {
+        int dirX, dirY;
+        choose(round, player, dirX, dirY);
+        round.steer(player, dirX, dirY);
+    }
+
+    // Elige la dirección sin tocar la ronda (el modo en red la manda como entrada)
+    void choose(const TronRound& round, int player, int& dirX, int& dirY) {
+        const TronPlayer& me = round.getPlayer(player);
+        const TronPlayer& rival = round.getPlayer(1 - player);
+        const OccupancyGrid& grid = round.getGrid();
+        prepare(grid);
+
+        // Los tres movimientos posibles: seguir, girar a un lado o al otro
+        const int moves[3][2] = {{me.dirX, me.dirY}, {me.dirY, -me.dirX}, {-me.dirY, me.dirX}};
+
+        if (kind == TronBotKind::VORONOI) {
+            rivalReach = search(grid, rival.x, rival.y, rivals);
+        }
+
+        long long bestScore = 0;
+        int best[3];
+        int bestCount = 0;
+        for (int i = 0; i < 3; ++i) {
+            int x = TronRound::wrap(me.x + moves[i][0], grid.getWidth());
+            int y = TronRound::wrap(me.y + moves[i][1], grid.getHeight());
+            long long score = evaluate(grid, x, y, rival);
+            if (bestCount == 0 || score > bestScore) {
+                bestScore = score;
+                bestCount = 0;
+            }
+            if (score == bestScore) {
+                best[bestCount++] = i;
+            }
+        }
+
+        const int* move = moves[best[random.nextInt(static_cast<std::uint32_t>(bestCount))]];
+        dirX = move[0];
+        dirY = move[1];
+    }
+
+private:
+    // Puntaje muy bajo para un movimiento que choca en el tick siguiente
+    static const long long CRASH = -(1LL << 40);
+    // Entrar en una celda a la que también puede entrar el rival arriesga un empate
+    static const long long CONTESTED = -(1LL << 30);
+
+    // Marcas y distancias de una búsqueda. Una celda está marcada si guarda
+    // el número de la búsqueda actual.
+    struct Field {
+        std::vector<std::uint32_t> mark;
+        std::vector<std::uint32_t> distance;
+        std::uint32_t stamp = 0;
+
+        void resize(std::size_t cells) {
+            mark.assign(cells, 0);
+            distance.assign(cells, 0);
+            stamp = 0;
+        }
+
+        void next() {
+            if (++stamp == 0) {
+                // Dio la vuelta el contador: se limpia una vez cada 4 mil millones de búsquedas
+                std::fill(mark.begin(), mark.end(), 0);
+                stamp = 1;
+            }
+        }
+
+        bool reached(std::uint32_t cell) const {
+            return mark[cell] == stamp;
+        }
+    };
+
+    void prepare(const OccupancyGrid& grid) {
+        std::size_t cells = static_cast<std::size_t>(grid.getWidth()) * grid.getHeight();
+        if (queue.size() != cells) {
+            queue.assign(cells, 0);
+            own.resize(cells);
+            rivals.resize(cells);
+        }
+    }
+
+    long long evaluate(const OccupancyGrid& grid, int x, int y, const TronPlayer& rival) {
+        if (grid.isOccupied(x, y)) {
+            return CRASH;
+        }
+        long long penalty = 0;
+        int dx = std::abs(x - rival.x);
+        int dy = std::abs(y - rival.y);
+        dx = std::min(dx, grid.getWidth() - dx);
+        dy = std::min(dy, grid.getHeight() - dy);
+        if (dx + dy == 1) {
+            penalty = CONTESTED;
+        }
+
+        switch (kind) {
+            case TronBotKind::RANDOM:
+                return penalty;
+            case TronBotKind::FLOOD_FILL:
+                return penalty + static_cast<long long>(search(grid, x, y, own));
+            case TronBotKind::VORONOI:
+                return penalty + territory(grid, x, y);
+        }
+        return penalty;
+    }
+
+    // BFS sobre celdas libres desde (x, y), que cuenta como distancia 0 aunque
+    // esté ocupada (la cabeza del rival). Deja en queue las celdas alcanzadas
+    // en orden y retorna cuántas son.
+    std::size_t search(const OccupancyGrid& grid, int x, int y, Field& field) {
+        field.next();
+        int width = grid.getWidth();
+        int height = grid.getHeight();
+        std::size_t head = 0;
+        std::size_t tail = 0;
+        std::uint32_t start = static_cast<std::uint32_t>(y * width + x);
+        field.mark[start] = field.stamp;
+        field.distance[start] = 0;
+        queue[tail++] = start;
+
+        while (head < tail) {
+            std::uint32_t cell = queue[head++];
+            int cx = static_cast<int>(cell % width);
+            int cy = static_cast<int>(cell / width);
+            const int neighbours[4][2] = {{TronRound::wrap(cx + 1, width), cy}, {TronRound::wrap(cx - 1, width), cy},
+                                          {cx, TronRound::wrap(cy + 1, height)}, {cx, TronRound::wrap(cy - 1, height)}};
+            for (const auto& n : neighbours) {
+                std::uint32_t next = static_cast<std::uint32_t>(n[1] * width + n[0]);
+                if (field.mark[next] == field.stamp || grid.isOccupied(n[0], n[1])) {
+                    continue;
+                }
+                field.mark[next] = field.stamp;
+                field.distance[next] = field.distance[cell] + 1;
+                queue[tail++] = next;
+            }
+        }
+        return tail;
+    }
+
+    // Celdas a las que llegamos antes que el rival menos las que el rival
+    // alcanza antes; los empates no cuentan para nadie. Nuestra cabeza ya
+    // avanzó un tick y la del rival todavía no, así que sumamos 1 a nuestras
+    // distancias. Usa la búsqueda del rival hecha en think().
+    long long territory(const OccupancyGrid& grid, int x, int y) {
+        std::size_t reached = search(grid, x, y, own);
+        std::size_t mine = 0;
+        std::size_t notTheirs = 0;  // Alcanzadas por ambos, con nosotros antes o a la par
+        for (std::size_t i = 0; i < reached; ++i) {
+            std::uint32_t cell = queue[i];
+            std::uint32_t ours = own.distance[cell] + 1;
+            if (!rivals.reached(cell)) {
+                ++mine;
+            } else if (ours <= rivals.distance[cell]) {
+                ++notTheirs;
+                if (ours < rivals.distance[cell]) {
+                    ++mine;
+                }
+            }
+        }
+        long long theirs = static_cast<long long>(rivalReach) - static_cast<long long>(notTheirs);
+        return static_cast<long long>(mine) - theirs;
+    }
+
+    TronBotKind kind;
+    Xoshiro128 random;
+
+    std::vector<std::uint32_t> queue;
+    Field own;
+    Field rivals;
+    std::size_t rivalReach = 0;
+};
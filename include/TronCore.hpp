@@ -0,0 +1,223 @@
+#pragma once
+
+#include <cstdint>
+
+#include "OccupancyGrid.hpp"
+#include "Random.hpp"
+
+// Núcleo de una ronda de Tron: dos motos en una arena que se cierra sobre sí
+// misma (salir por un borde es entrar por el opuesto), cada una deja una
+// estela y pierde la que entra en una celda ocupada. No depende de SFML: lo
+// usan 08_Tron y el torneo sin ventana (bench/TronTournament.cpp).
+//
+// Una ronda se reinicia con reset() sin reservar memoria salvo que cambie el
+// tamaño de la arena, así que un mismo TronRound juega miles de rondas.
+
+const int TRON_PLAYERS = 2;
+
+enum class TronOutcome : std::uint8_t {
+    PLAYING,
+    PLAYER1_WINS,
+    PLAYER2_WINS,
+    DRAW                // Chocaron los dos en el mismo tick
+};
+
+struct TronPlayer {
+    int x = 0;
+    int y = 0;
+    int dirX = 0;
+    int dirY = -1;
+    bool alive = true;
+};
+
+// Estado de una ronda después de un tick, para volver atrás (rollback en el
+// modo en red). No copia la arena: las únicas celdas que marca un tick son las
+// cabezas de los jugadores que siguen vivos, así que con las cabezas alcanza
+// para deshacerlo. Ocupa unos 44 bytes con cualquier tamaño de arena.
+struct TronSnapshot {
+    TronPlayer players[TRON_PLAYERS];
+    std::uint32_t tickCount = 0;
+    TronOutcome outcome = TronOutcome::PLAYING;
+};
+
+class TronRound {
+public:
+    // Posiciones fijas: un cuarto y tres cuartos del ancho, a media altura, hacia arriba
+    void reset(int width, int height) {
+        prepare(width, height);
+        place(0, width / 4, height / 2, 0, -1);
+        place(1, width - width / 4, height / 2, 0, -1);
+    }
+
+    // Posición y dirección al azar para el jugador 1; el 2 sale en la posición
+    // simétrica respecto del centro, mirando al lado opuesto (partida pareja)
+    void reset(int width, int height, Xoshiro128& random) {
+        prepare(width, height);
+        static const int DIRECTIONS[4][2] = {{0, -1}, {0, 1}, {-1, 0}, {1, 0}};
+        int x = 1 + static_cast<int>(random.nextInt(static_cast<std::uint32_t>(width / 2 - 1)));
+        int y = static_cast<int>(random.nextInt(static_cast<std::uint32_t>(height)));
+        const int* dir = DIRECTIONS[random.nextInt(4)];
+        place(0, x, y, dir[0], dir[1]);
+        place(1, width - 1 - x, height - 1 - y, -dir[0], -dir[1]);
+    }
+
+    // Cambia la dirección para el próximo tick. Dar la vuelta en el lugar no se permite.
+    void steer(int player, int dirX, int dirY) {
+        TronPlayer& p = players[player];
+        if ((dirX != 0) == (dirY != 0) || (dirX == -p.dirX && dirY == -p.dirY)) {
+            return;
+        }
+        p.dirX = dirX;
+        p.dirY = dirY;
+    }
+
+    // Mueven los dos a la vez: choca el que entra en una celda ocupada, y si
+    // entran en la misma celda chocan ambos
+    void tick() {
+        if (outcome != TronOutcome::PLAYING) {
+            return;
+        }
+        ++tickCount;
+
+        bool crashed[TRON_PLAYERS];
+        for (int i = 0; i < TRON_PLAYERS; ++i) {
+            TronPlayer& p = players[i];
+            p.x = wrap(p.x + p.dirX, grid.getWidth());
+            p.y = wrap(p.y + p.dirY, grid.getHeight());
+            crashed[i] = grid.isOccupied(p.x, p.y);
+        }
+        if (players[0].x == players[1].x && players[0].y == players[1].y) {
+            crashed[0] = crashed[1] = true;
+        }
+
+        for (int i = 0; i < TRON_PLAYERS; ++i) {
+            if (crashed[i]) {
+                players[i].alive = false;
+            } else {
+                grid.set(players[i].x, players[i].y, static_cast<std::uint8_t>(i + 1));
+            }
+        }
+
+        if (!players[0].alive && !players[1].alive) {
+            outcome = TronOutcome::DRAW;
+        } else if (!players[1].alive) {
+            outcome = TronOutcome::PLAYER1_WINS;
+        } else if (!players[0].alive) {
+            outcome = TronOutcome::PLAYER2_WINS;
+        } else if (tickCount >= maxTicks) {
+            outcome = TronOutcome::DRAW; // No puede pasar en una arena cerrada; por las dudas
+        }
+    }
+
+    bool isOver() const {
+        return outcome != TronOutcome::PLAYING;
+    }
+
+    TronOutcome getOutcome() const {
+        return outcome;
+    }
+
+    const TronPlayer& getPlayer(int player) const {
+        return players[player];
+    }
+
+    const OccupancyGrid& getGrid() const {
+        return grid;
+    }
+
+    std::uint32_t getTickCount() const {
+        return tickCount;
+    }
+
+    int getWidth() const {
+        return grid.getWidth();
+    }
+
+    int getHeight() const {
+        return grid.getHeight();
+    }
+
+    TronSnapshot save() const {
+        TronSnapshot snapshot;
+        for (int i = 0; i < TRON_PLAYERS; ++i) {
+            snapshot.players[i] = players[i];
+        }
+        snapshot.tickCount = tickCount;
+        snapshot.outcome = outcome;
+        return snapshot;
+    }
+
+    // Deshace un tick: la ronda tiene que estar en 'current' (guardado justo
+    // después de ese tick) y vuelve a 'previous' (guardado justo antes).
+    // Libera las celdas que marcó el tick y llama released(x, y) por cada una.
+    template <typename Released>
+    void undo(const TronSnapshot& current, const TronSnapshot& previous, Released&& released) {
+        if (current.tickCount != previous.tickCount) {
+            for (int i = 0; i < TRON_PLAYERS; ++i) {
+                if (current.players[i].alive) {
+                    grid.set(current.players[i].x, current.players[i].y, OccupancyGrid::EMPTY);
+                    released(current.players[i].x, current.players[i].y);
+                }
+            }
+        }
+        for (int i = 0; i < TRON_PLAYERS; ++i) {
+            players[i] = previous.players[i];
+        }
+        tickCount = previous.tickCount;
+        outcome = previous.outcome;
+    }
+
+    // FNV-1a del estado de las cabezas; la arena queda determinada por la
+    // historia de las cabezas, así que dos rondas con el mismo checksum en
+    // todos los ticks jugaron igual
+    std::uint32_t checksum() const {
+        std::uint32_t hash = 2166136261u;
+        auto mix = [&hash](std::uint32_t value) {
+            for (int b = 0; b < 4; ++b) {
+                hash = (hash ^ ((value >> (b * 8)) & 0xFF)) * 16777619u;
+            }
+        };
+        mix(tickCount);
+        mix(static_cast<std::uint32_t>(outcome));
+        for (const TronPlayer& p : players) {
+            mix(static_cast<std::uint32_t>(p.x));
+            mix(static_cast<std::uint32_t>(p.y));
+            mix(static_cast<std::uint32_t>(p.dirX));
+            mix(static_cast<std::uint32_t>(p.dirY));
+            mix(p.alive ? 1u : 0u);
+        }
+        return hash;
+    }
+
+    static int wrap(int value, int size) {
+        return value < 0 ? value + size : (value >= size ? value - size : value);
+    }
+
+private:
+    void prepare(int width, int height) {
+        if (grid.getWidth() != width || grid.getHeight() != height) {
+            grid.resize(width, height);
+        } else {
+            grid.clear();
+        }
+        tickCount = 0;
+        maxTicks = static_cast<std::uint32_t>(width) * height;
+        outcome = TronOutcome::PLAYING;
+    }
+
+    void place(int player, int x, int y, int dirX, int dirY) {
+        TronPlayer& p = players[player];
+        p.x = x;
+        p.y = y;
+        p.dirX = dirX;
+        p.dirY = dirY;
+        p.alive = true;
+        grid.set(x, y, static_cast<std::uint8_t>(player + 1));
+    }
+
+    OccupancyGrid grid;
+    TronPlayer players[TRON_PLAYERS];
+    std::uint32_t tickCount = 0;
+    std::uint32_t maxTicks = 0;
+    TronOutcome outcome = TronOutcome::PLAYING;
+};
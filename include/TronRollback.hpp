@@ -0,0 +1,451 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+#include "TronCore.hpp"
+
+// Modo en red de Tron con rollback. Cada máquina simula la partida completa;
+// por la red solo viajan las direcciones elegidas en cada frame. La entrada
+// local se aplica en el frame siguiente (un tick de latencia, como jugando en
+// el mismo teclado) y la del rival, mientras no llega, se predice repitiendo
+// la última conocida. Cuando llega una entrada distinta a la predicha se
+// vuelve al frame anterior y se re-simulan los frames desde ahí.
+//
+// Cada frame guarda un TronSnapshot (las cabezas, no la arena) en un anillo de
+// ROLLBACK_FRAMES; volver atrás deshace tick por tick liberando las celdas que
+// marcó cada uno. No se puede adelantar más de MAX_PREDICTION frames al último
+// frame confirmado del rival: ahí advance() espera.
+//
+// Entre rondas hay una pausa de ROUND_PAUSE_FRAMES; como es más larga que
+// MAX_PREDICTION, cuando una ronda se reinicia su final ya está confirmado y
+// ningún rollback cruza un reinicio.
+//
+// No depende de SFML ni de sockets: writePacket() y readPacket() trabajan con
+// bytes y el juego los manda por UDP (08_Tron.cpp) o el arnés de prueba por un
+// LossyLink en memoria (bench/TronNetLoopback.cpp).
+
+const std::uint32_t ROLLBACK_FRAMES = 64;       // Potencia de 2
+const std::uint32_t MAX_PREDICTION = 16;
+const std::uint32_t ROUND_PAUSE_FRAMES = 60;
+const std::size_t TRON_PACKET_SIZE = 40;
+
+// Una dirección en 2 bits: arriba, abajo, izquierda, derecha
+inline std::uint8_t encodeTronDirection(int dirX, int dirY) {
+    if (dirY < 0) return 0;
+    if (dirY > 0) return 1;
+    if (dirX < 0) return 2;
+    return 3;
+}
+
+inline void decodeTronDirection(std::uint8_t code, int& dirX, int& dirY) {
+    static const int DIRECTIONS[4][2] = {{0, -1}, {0, 1}, {-1, 0}, {1, 0}};
+    dirX = DIRECTIONS[code & 3][0];
+    dirY = DIRECTIONS[code & 3][1];
+}
+
+struct TronNetStats {
+    std::uint64_t rollbacks = 0;
+    std::uint64_t resimulatedFrames = 0;
+    std::uint32_t maxRollback = 0;      // Frames re-simulados en el peor rollback
+    std::uint64_t stalls = 0;           // advance() que esperaron al rival
+    std::uint64_t packetsSent = 0;
+    std::uint64_t packetsReceived = 0;
+    std::uint64_t packetsRejected = 0;
+    std::uint64_t checks = 0;           // Checksums del rival comparados con los propios
+    std::uint64_t desyncs = 0;          // ...que no coincidieron
+};
+
+class TronRollbackSession {
+public:
+    TronRollbackSession(int arenaSize, int localPlayer)
+        : size(arenaSize), localPlayer(localPlayer), remotePlayer(1 - localPlayer) {
+        changes.reserve(MAX_CHANGES);
+        start();
+    }
+
+    // Vuelve al frame 0 de la primera ronda
+    void start() {
+        round.reset(size, size);
+        frame = 0;
+        remoteConfirmed = 0;
+        remoteAck = 0;
+        rollbackFrom = NONE;
+        peerCheckFrame = NONE;
+        lastCheckedFrame = NONE;
+        scores[0] = scores[1] = 0;
+        overFrame = 0;
+        roundNumber = 0;
+        stats = TronNetStats{};
+        for (int p = 0; p < TRON_PLAYERS; ++p) {
+            for (std::uint32_t i = 0; i < ROLLBACK_FRAMES; ++i) {
+                inputFrame[p][i] = NONE;
+            }
+            const TronPlayer& player = round.getPlayer(p);
+            setInput(p, 0, encodeTronDirection(player.dirX, player.dirY));
+        }
+        store(0, false);
+        changes.clear();
+        repaint = true;
+    }
+
+    // Avanza un frame con la dirección local. Retorna false si no avanzó
+    // porque la predicción ya está MAX_PREDICTION frames adelante del rival.
+    bool advance(int dirX, int dirY) {
+        applyRollback();
+        if (frame >= remoteConfirmed + MAX_PREDICTION) {
+            ++stats.stalls;
+            return false;
+        }
+        std::uint32_t next = frame + 1;
+        setInput(localPlayer, next, encodeTronDirection(dirX, dirY));
+        simulate(next);
+        frame = next;
+        checkPeer();
+        return true;
+    }
+
+    // Arma un paquete con las entradas locales que el rival todavía no
+    // confirmó (se repiten hasta que las confirma: así se recupera de
+    // paquetes perdidos sin retransmisiones) y el checksum del último frame
+    // confirmado. Retorna su tamaño.
+    std::size_t writePacket(std::uint8_t* out, std::size_t capacity) {
+        if (capacity < TRON_PACKET_SIZE) {
+            return 0;
+        }
+        applyRollback();
+
+        std::uint32_t first = remoteAck + 1;
+        if (frame >= INPUT_WINDOW && first < frame - INPUT_WINDOW + 1) {
+            first = frame - INPUT_WINDOW + 1;
+        }
+        std::uint32_t count = frame >= first ? frame - first + 1 : 0;
+        std::uint32_t confirmed = getConfirmedFrame();
+
+        std::size_t at = 0;
+        out[at++] = 'T';
+        out[at++] = 'R';
+        out[at++] = PACKET_VERSION;
+        out[at++] = static_cast<std::uint8_t>(localPlayer);
+        writeU32(out, at, frame);
+        writeU32(out, at, remoteConfirmed);
+        writeU32(out, at, first);
+        out[at++] = static_cast<std::uint8_t>(count);
+        for (std::uint32_t i = 0; i < count; i += 4) {
+            std::uint8_t packed = 0;
+            for (std::uint32_t j = 0; j < 4 && i + j < count; ++j) {
+                packed |= static_cast<std::uint8_t>(input(localPlayer, first + i + j) << (j * 2));
+            }
+            out[at++] = packed;
+        }
+        writeU32(out, at, confirmed);
+        writeU32(out, at, frames[confirmed % ROLLBACK_FRAMES].checksum);
+        ++stats.packetsSent;
+        return at;
+    }
+
+    // Retorna false si no es un paquete de este modo o no viene del rival
+    bool readPacket(const std::uint8_t* data, std::size_t length) {
+        std::size_t at = 0;
+        if (length < HEADER_SIZE || data[0] != 'T' || data[1] != 'R' || data[2] != PACKET_VERSION ||
+            data[3] != static_cast<std::uint8_t>(remotePlayer)) {
+            ++stats.packetsRejected;
+            return false;
+        }
+        at = 4;
+        std::uint32_t senderFrame = readU32(data, at);
+        std::uint32_t ack = readU32(data, at);
+        std::uint32_t first = readU32(data, at);
+        std::uint32_t count = data[at++];
+        if (count > INPUT_WINDOW || length != HEADER_SIZE + (count + 3) / 4 + 8 ||
+            (count > 0 && first + count - 1 != senderFrame)) {
+            ++stats.packetsRejected;
+            return false;
+        }
+        const std::uint8_t* packed = data + at;
+        at += (count + 3) / 4;
+        std::uint32_t checkFrame = readU32(data, at);
+        std::uint32_t checksum = readU32(data, at);
+        ++stats.packetsReceived;
+
+        if (ack > remoteAck) {
+            remoteAck = ack < frame ? ack : frame;
+        }
+
+        for (std::uint32_t i = 0; i < count; ++i) {
+            std::uint32_t f = first + i;
+            if (f <= remoteConfirmed || f > frame + INPUT_WINDOW || inputFrame[remotePlayer][f % ROLLBACK_FRAMES] == f) {
+                continue;
+            }
+            std::uint8_t code = static_cast<std::uint8_t>((packed[i / 4] >> ((i % 4) * 2)) & 3);
+            setInput(remotePlayer, f, code);
+            // Un frame ya simulado con otra predicción se corrige en el próximo advance()
+            const Frame& slot = frames[f % ROLLBACK_FRAMES];
+            if (f <= frame && slot.consumed && slot.inputs[remotePlayer] != code && f < rollbackFrom) {
+                rollbackFrom = f;
+            }
+        }
+        while (inputFrame[remotePlayer][(remoteConfirmed + 1) % ROLLBACK_FRAMES] == remoteConfirmed + 1) {
+            ++remoteConfirmed;
+        }
+
+        if (peerCheckFrame == NONE || checkFrame > peerCheckFrame) {
+            peerCheckFrame = checkFrame;
+            peerChecksum = checksum;
+        }
+        return true;
+    }
+
+    // Llama paint(x, y, dueño) por cada celda que cambió desde la última vez
+    // (dueño 0 = liberada por un rollback). Retorna true si en cambio hay que
+    // repintar toda la arena: empezó una ronda o hubo demasiados cambios.
+    template <typename Paint>
+    bool drainChanges(Paint&& paint) {
+        bool full = repaint;
+        if (!full) {
+            for (const CellChange& change : changes) {
+                paint(change.x, change.y, change.owner);
+            }
+        }
+        changes.clear();
+        repaint = false;
+        return full;
+    }
+
+    const TronRound& getRound() const {
+        return round;
+    }
+
+    int getLocalPlayer() const {
+        return localPlayer;
+    }
+
+    std::uint32_t getFrame() const {
+        return frame;
+    }
+
+    // Último frame con las entradas de los dos jugadores conocidas
+    std::uint32_t getConfirmedFrame() const {
+        return frame < remoteConfirmed ? frame : remoteConfirmed;
+    }
+
+    int getScore(int player) const {
+        return scores[player];
+    }
+
+    std::uint32_t getRoundNumber() const {
+        return roundNumber;
+    }
+
+    // Checksum de un frame que todavía está en el anillo
+    bool getChecksum(std::uint32_t target, std::uint32_t& checksum) const {
+        const Frame& slot = frames[target % ROLLBACK_FRAMES];
+        if (target > frame || slot.frame != target) {
+            return false;
+        }
+        checksum = slot.checksum;
+        return true;
+    }
+
+    const TronNetStats& getStats() const {
+        return stats;
+    }
+
+private:
+    static constexpr std::uint32_t NONE = 0xFFFFFFFF;
+    static const std::uint32_t INPUT_WINDOW = ROLLBACK_FRAMES / 2;
+    static const std::uint8_t PACKET_VERSION = 1;
+    // "TR" | versión | jugador | frame | ack | primer frame | cantidad
+    static const std::size_t HEADER_SIZE = 4 + 4 + 4 + 4 + 1;
+    static const std::size_t MAX_CHANGES = 4 * ROLLBACK_FRAMES * TRON_PLAYERS;
+
+    struct Frame {
+        std::uint32_t frame = NONE;
+        TronSnapshot round;
+        int scores[TRON_PLAYERS] = {0, 0};
+        std::uint32_t overFrame = 0;
+        std::uint32_t roundNumber = 0;
+        std::uint8_t inputs[TRON_PLAYERS] = {0, 0};   // Entradas con que se simuló
+        bool consumed = false;                          // false si la ronda estaba terminada
+        std::uint32_t checksum = 0;
+    };
+
+    struct CellChange {
+        int x;
+        int y;
+        std::uint8_t owner;
+    };
+
+    static void writeU32(std::uint8_t* out, std::size_t& at, std::uint32_t value) {
+        for (int b = 0; b < 4; ++b) {
+            out[at++] = static_cast<std::uint8_t>(value >> (b * 8));
+        }
+    }
+
+    static std::uint32_t readU32(const std::uint8_t* data, std::size_t& at) {
+        std::uint32_t value = 0;
+        for (int b = 0; b < 4; ++b) {
+            value |= static_cast<std::uint32_t>(data[at++]) << (b * 8);
+        }
+        return value;
+    }
+
+    void setInput(int player, std::uint32_t f, std::uint8_t code) {
+        inputFrame[player][f % ROLLBACK_FRAMES] = f;
+        inputs[player][f % ROLLBACK_FRAMES] = code;
+    }
+
+    // Entrada conocida o, para el rival, la predicción: la del último frame confirmado
+    std::uint8_t input(int player, std::uint32_t f) const {
+        if (inputFrame[player][f % ROLLBACK_FRAMES] == f) {
+            return inputs[player][f % ROLLBACK_FRAMES];
+        }
+        return inputs[player][remoteConfirmed % ROLLBACK_FRAMES];
+    }
+
+    void record(int x, int y, std::uint8_t owner) {
+        if (repaint) {
+            return;
+        }
+        if (changes.size() == MAX_CHANGES) {
+            repaint = true;
+            changes.clear();
+            return;
+        }
+        changes.push_back(CellChange{x, y, owner});
+    }
+
+    void simulate(std::uint32_t f) {
+        std::uint8_t used[TRON_PLAYERS];
+        for (int p = 0; p < TRON_PLAYERS; ++p) {
+            used[p] = input(p, f);
+        }
+
+        bool consumed = false;
+        if (round.isOver()) {
+            if (f - overFrame >= ROUND_PAUSE_FRAMES) {
+                round.reset(size, size);
+                ++roundNumber;
+                changes.clear();
+                repaint = true;
+            }
+        } else {
+            for (int p = 0; p < TRON_PLAYERS; ++p) {
+                int dirX, dirY;
+                decodeTronDirection(used[p], dirX, dirY);
+                round.steer(p, dirX, dirY);
+            }
+            round.tick();
+            consumed = true;
+            for (int p = 0; p < TRON_PLAYERS; ++p) {
+                const TronPlayer& player = round.getPlayer(p);
+                if (player.alive) {
+                    record(player.x, player.y, static_cast<std::uint8_t>(p + 1));
+                }
+            }
+            if (round.isOver()) {
+                // Cada choque suma un punto al rival (en un empate, a los dos)
+                overFrame = f;
+                if (!round.getPlayer(0).alive) ++scores[1];
+                if (!round.getPlayer(1).alive) ++scores[0];
+            }
+        }
+
+        Frame& slot = frames[f % ROLLBACK_FRAMES];
+        slot.inputs[0] = used[0];
+        slot.inputs[1] = used[1];
+        store(f, consumed);
+    }
+
+    void store(std::uint32_t f, bool consumed) {
+        Frame& slot = frames[f % ROLLBACK_FRAMES];
+        slot.frame = f;
+        slot.round = round.save();
+        slot.scores[0] = scores[0];
+        slot.scores[1] = scores[1];
+        slot.overFrame = overFrame;
+        slot.roundNumber = roundNumber;
+        slot.consumed = consumed;
+
+        std::uint32_t hash = round.checksum();
+        for (std::uint32_t value : {roundNumber, static_cast<std::uint32_t>(scores[0]),
+                                    static_cast<std::uint32_t>(scores[1])}) {
+            hash = (hash ^ value) * 16777619u;
+        }
+        slot.checksum = hash;
+    }
+
+    // Vuelve al frame anterior a la primera predicción equivocada y re-simula
+    // hasta el frame actual con las entradas corregidas
+    void applyRollback() {
+        if (rollbackFrom == NONE) {
+            return;
+        }
+        std::uint32_t target = rollbackFrom - 1;
+        rollbackFrom = NONE;
+
+        for (std::uint32_t f = frame; f > target; --f) {
+            round.undo(frames[f % ROLLBACK_FRAMES].round, frames[(f - 1) % ROLLBACK_FRAMES].round,
+                       [this](int x, int y) { record(x, y, 0); });
+        }
+        const Frame& base = frames[target % ROLLBACK_FRAMES];
+        scores[0] = base.scores[0];
+        scores[1] = base.scores[1];
+        overFrame = base.overFrame;
+        roundNumber = base.roundNumber;
+
+        for (std::uint32_t f = target + 1; f <= frame; ++f) {
+            simulate(f);
+        }
+
+        std::uint32_t depth = frame - target;
+        ++stats.rollbacks;
+        stats.resimulatedFrames += depth;
+        if (depth > stats.maxRollback) {
+            stats.maxRollback = depth;
+        }
+    }
+
+    // Compara el checksum que mandó el rival con el propio del mismo frame,
+    // una vez que ese frame está confirmado de este lado también
+    void checkPeer() {
+        if (peerCheckFrame == NONE || peerCheckFrame == lastCheckedFrame || peerCheckFrame > getConfirmedFrame()) {
+            return;
+        }
+        std::uint32_t own;
+        if (getChecksum(peerCheckFrame, own)) {
+            ++stats.checks;
+            if (own != peerChecksum) {
+                ++stats.desyncs;
+            }
+        }
+        lastCheckedFrame = peerCheckFrame;
+    }
+
+    int size;
+    int localPlayer;
+    int remotePlayer;
+    TronRound round;
+
+    Frame frames[ROLLBACK_FRAMES];
+    std::uint8_t inputs[TRON_PLAYERS][ROLLBACK_FRAMES];
+    std::uint32_t inputFrame[TRON_PLAYERS][ROLLBACK_FRAMES];
+
+    std::uint32_t frame = 0;
+    std::uint32_t remoteConfirmed = 0;  // Entradas del rival recibidas sin huecos hasta este frame
+    std::uint32_t remoteAck = 0;        // Entradas locales que el rival ya confirmó
+    std::uint32_t rollbackFrom = NONE;  // Primer frame simulado con una predicción equivocada
+    std::uint32_t peerCheckFrame = NONE;
+    std::uint32_t peerChecksum = 0;
+    std::uint32_t lastCheckedFrame = NONE;
+
+    int scores[TRON_PLAYERS] = {0, 0};
+    std::uint32_t overFrame = 0;
+    std::uint32_t roundNumber = 0;
+
+    std::vector<CellChange> changes;
+    bool repaint = true;
+    TronNetStats stats;
+};
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "EntityPool.hpp"
+
+// Broadphase de rejilla uniforme para colisiones AABB.
+//
+// Cada tick se reinsertan las cajas (ya calculadas por los pools) y solo se
+// limpian las celdas que quedaron ocupadas en el tick anterior, así que el
+// costo de reconstruir depende del número de entidades y no del tamaño de la
+// rejilla. Las posiciones fuera de la rejilla se sujetan a las celdas del borde.
+// No reserva memoria: todo vive en arreglos de capacidad fija.
+//
+// Un elemento que ocupa más de MaxCellsPerItem celdas se guarda en una lista
+// aparte que se prueba siempre, para no perder colisiones con cajas enormes.
+template <std::size_t MaxItems, int Columns, int Rows, int MaxCellsPerItem = 9>
+class UniformGrid {
+    static_assert(MaxItems < 0x7FFF, "Los indices de elementos usan 16 bits");
+
+public:
+    static constexpr int CELL_COUNT = Columns * Rows;
+    static constexpr std::size_t MAX_REFS = MaxItems * MaxCellsPerItem;
+
+    static_assert(MAX_REFS < 0x7FFF, "Las referencias por celda usan 16 bits");
+
+    UniformGrid(float originX, float originY, float cellSize)
+        : originX(originX), originY(originY), inverseCellSize(1.0f / cellSize) {
+        cellHead.fill(NONE);
+        visitStamp.fill(0);
+    }
+
+    // Vacía la rejilla tocando solo las celdas que se usaron
+    void clear() {
+        for (std::size_t i = 0; i < touchedCount; ++i) {
+            cellHead[touchedCells[i]] = NONE;
+        }
+        touchedCount = 0;
+        refCount = 0;
+        oversizeCount = 0;
+    }
+
+    // Reconstruye la rejilla con las cajas de un pool (posiciones densas [0, count))
+    void rebuild(const Aabb* itemBounds, std::size_t count) {
+        clear();
+        for (std::size_t i = 0; i < count && i < MaxItems; ++i) {
+            insert(static_cast<std::uint16_t>(i), itemBounds[i]);
+        }
+    }
+
+    void insert(std::uint16_t id, const Aabb& box) {
+        boxes[id] = box;
+
+        int minX, minY, maxX, maxY;
+        cellRange(box, minX, minY, maxX, maxY);
+
+        int cells = (maxX - minX + 1) * (maxY - minY + 1);
+        if (cells > MaxCellsPerItem || refCount + static_cast<std::size_t>(cells) > MAX_REFS) {
+            oversize[oversizeCount++] = id;
+            return;
+        }
+
+        for (int cy = minY; cy <= maxY; ++cy) {
+            for (int cx = minX; cx <= maxX; ++cx) {
+                int cell = cy * Columns + cx;
+                if (cellHead[cell] == NONE) {
+                    touchedCells[touchedCount++] = static_cast<std::uint16_t>(cell);
+                }
+                refItem[refCount] = id;
+                refNext[refCount] = cellHead[cell];
+                cellHead[cell] = static_cast<std::int16_t>(refCount);
+                ++refCount;
+            }
+        }
+    }
+
+    // Llama a onHit(id) por cada elemento cuya caja se intersecta con 'box'.
+    // Cada elemento se reporta una sola vez. Si onHit retorna false la consulta
+    // se detiene (por ejemplo, cuando una bala ya se consumió).
+    template <class Callback>
+    void query(const Aabb& box, Callback&& onHit) const {
+        ++currentStamp;
+
+        for (std::size_t i = 0; i < oversizeCount; ++i) {
+            if (!visit(oversize[i], box, onHit)) {
+                return;
+            }
+        }
+
+        int minX, minY, maxX, maxY;
+        cellRange(box, minX, minY, maxX, maxY);
+
+        for (int cy = minY; cy <= maxY; ++cy) {
+            for (int cx = minX; cx <= maxX; ++cx) {
+                for (std::int16_t ref = cellHead[cy * Columns + cx]; ref != NONE; ref = refNext[ref]) {
+                    if (!visit(refItem[ref], box, onHit)) {
+                        return;
+                    }
+                }
+            }
+        }
+    }
+
+    // Prueba cada caja de 'queryBounds' contra la rejilla y llama a
+    // onPair(i, id) por cada par que se intersecta. El valor de retorno de
+    // onPair indica si 'i' sigue buscando más pares.
+    template <class Callback>
+    void forEachPair(const Aabb* queryBounds, std::size_t count, Callback&& onPair) const {
+        for (std::size_t i = 0; i < count; ++i) {
+            query(queryBounds[i], [&](std::uint16_t id) {
+                return onPair(i, static_cast<std::size_t>(id));
+            });
+        }
+    }
+
+private:
+    static constexpr std::int16_t NONE = -1;
+
+    void cellRange(const Aabb& box, int& minX, int& minY, int& maxX, int& maxY) const {
+        minX = clampColumn(static_cast<int>((box.left - originX) * inverseCellSize));
+        maxX = clampColumn(static_cast<int>((box.right - originX) * inverseCellSize));
+        minY = clampRow(static_cast<int>((box.top - originY) * inverseCellSize));
+        maxY = clampRow(static_cast<int>((box.bottom - originY) * inverseCellSize));
+    }
+
+    static int clampColumn(int column) {
+        return std::min(std::max(column, 0), Columns - 1);
+    }
+
+    static int clampRow(int row) {
+        return std::min(std::max(row, 0), Rows - 1);
+    }
+
+    template <class Callback>
+    bool visit(std::uint16_t id, const Aabb& box, Callback& onHit) const {
+        if (visitStamp[id] == currentStamp) {
+            return true;
+        }
+        visitStamp[id] = currentStamp;
+        if (!boxes[id].intersects(box)) {
+            return true;
+        }
+        return onHit(id);
+    }
+
+    float originX;
+    float originY;
+    float inverseCellSize;
+
+    std::array<std::int16_t, CELL_COUNT> cellHead;
+    std::array<std::uint16_t, CELL_COUNT> touchedCells;
+    std::size_t touchedCount = 0;
+
+    std::array<std::uint16_t, MAX_REFS> refItem;
+    std::array<std::int16_t, MAX_REFS> refNext;
+    std::size_t refCount = 0;
+
+    std::array<Aabb, MaxItems> boxes;
+    std::array<std::uint16_t, MaxItems> oversize;
+    std::size_t oversizeCount = 0;
+
+    mutable std::array<std::uint32_t, MaxItems> visitStamp;
+    mutable std::uint32_t currentStamp = 0;
+};
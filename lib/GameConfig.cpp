@@ -0,0 +1,99 @@
+#include "GameConfig.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "SaveFile.hpp"
+
+void saveConfig(const GameConfig& config) {
+    ByteWriter writer;
+    writer.f32(config.musicVolume);
+    writer.f32(config.sfxVolume);
+    for (std::size_t d = 0; d < HighScoreTables::keyCount(); ++d) {
+        ScorePage board = config.highScores[static_cast<GameDifficulty>(d)].all();
+        writer.u8(static_cast<std::uint8_t>(board.count));
+        for (std::size_t i = 0; i < board.count; ++i) {
+            writer.string(board.entries[i].getName());
+            writer.i32(board.entries[i].score);
+        }
+    }
+    getSaveWriter().save(CONFIG_PATH, packSaveFile(CONFIG_VERSION, writer.getBytes()));
+}
+
+// Formato de texto anterior (una línea por valor)
+static void loadTextConfig(GameConfig& config) {
+    std::ifstream file(CONFIG_PATH);
+    if (file.is_open()) {
+        file >> config.musicVolume;
+        file >> config.sfxVolume;
+
+        size_t numScores = 0;
+        file >> numScores;
+        file.ignore(); // Ignorar el salto de línea
+
+        config.highScores.clear();
+        for (size_t i = 0; i < numScores && file; ++i) {
+            std::string playerName, difficulty;
+            int score = 0;
+            std::getline(file, playerName);
+            file >> score;
+            file.ignore();
+            std::getline(file, difficulty);
+            config.highScores[parseDifficultyName(difficulty)].insert(playerName, score);
+        }
+        file.close();
+    }
+}
+
+void loadConfig(GameConfig& config) {
+    std::vector<std::uint8_t> file;
+    if (!readWholeFile(CONFIG_PATH, file) || file.empty()) {
+        return; // Primera ejecución: valores por defecto
+    }
+
+    std::uint16_t version = 0;
+    std::vector<std::uint8_t> payload;
+    SaveFileStatus status = unpackSaveFile(file, version, payload);
+    if (status == SaveFileStatus::NOT_A_SAVE_FILE) {
+        loadTextConfig(config); // Archivo de texto de versiones anteriores; se convierte al guardar
+        return;
+    }
+    if (status == SaveFileStatus::CORRUPT || version > CONFIG_VERSION) {
+        std::cerr << "game_config.dat danado o de una version mas nueva, se usan valores por defecto" << std::endl;
+        return;
+    }
+
+    GameConfig loaded;
+    ByteReader reader(payload);
+    loaded.musicVolume = reader.f32();
+    loaded.sfxVolume = reader.f32();
+    if (version == 1) {
+        // Versión 1: una sola lista con la dificultad como texto
+        std::size_t numScores = reader.u16();
+        for (std::size_t i = 0; i < numScores && reader.isOk(); ++i) {
+            std::string playerName = reader.string();
+            int score = reader.i32();
+            GameDifficulty difficulty = parseDifficultyName(reader.string());
+            loaded.highScores[difficulty].insert(playerName, score);
+        }
+    } else {
+        for (std::size_t d = 0; d < HighScoreTables::keyCount() && reader.isOk(); ++d) {
+            std::size_t numScores = reader.u8();
+            for (std::size_t i = 0; i < numScores && reader.isOk(); ++i) {
+                std::string playerName = reader.string();
+                int score = reader.i32();
+                loaded.highScores[static_cast<GameDifficulty>(d)].insert(playerName, score);
+            }
+        }
+    }
+    if (reader.isOk()) {
+        config = loaded;
+    }
+}
+
+void addHighScore(GameConfig& config, const std::string& playerName, int score, GameDifficulty difficulty) {
+    if (config.highScores[difficulty].insert(playerName, score) >= 0) {
+        saveConfig(config);
+    }
+}
@@ -0,0 +1,230 @@
+#include "Menus.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+void showSettings(sf::RenderWindow& window, GameResources& resources, GameConfig& config) {
+    const sf::Vector2f screen = window.getView().getSize();
+    
+    // Cargar fondo
+    auto bgTexture = resources.textures.get("assets/images/Menu principal.png");
+    bool hasBackground = bgTexture != nullptr;
+    sf::Sprite bgSprite(hasBackground ? *bgTexture : resources.textures.placeholder());
+    if (hasBackground) {
+        float scaleX = screen.x / bgTexture->getSize().x;
+        float scaleY = screen.y / bgTexture->getSize().y;
+        bgSprite.setScale(sf::Vector2f(scaleX, scaleY));
+    }
+    
+    // Overlay semitransparente
+    sf::RectangleShape overlay(screen);
+    overlay.setFillColor(sf::Color(0, 0, 0, 150));
+    
+    auto font = resources.fonts.get("assets/fonts/Minecraft.ttf");
+    if (!font) {
+        return;
+    }
+    
+    sf::Text titleText(*font);
+    titleText.setString("CONFIGURACIONES");
+    titleText.setCharacterSize(45);
+    titleText.setFillColor(sf::Color::Yellow);
+    titleText.setOutlineColor(sf::Color::Black);
+    titleText.setOutlineThickness(3);
+    titleText.setPosition(sf::Vector2f(280, 80));
+    
+    sf::Text musicText(*font);
+    musicText.setCharacterSize(30);
+    musicText.setFillColor(sf::Color::White);
+    musicText.setOutlineColor(sf::Color::Black);
+    musicText.setOutlineThickness(2);
+    musicText.setPosition(sf::Vector2f(200, 220));
+    
+    sf::Text sfxText(*font);
+    sfxText.setCharacterSize(30);
+    sfxText.setFillColor(sf::Color::White);
+    sfxText.setOutlineColor(sf::Color::Black);
+    sfxText.setOutlineThickness(2);
+    sfxText.setPosition(sf::Vector2f(200, 300));
+    
+    sf::Text instructionText(*font);
+    instructionText.setString("Usa Flechas para ajustar, ESC para salir");
+    instructionText.setCharacterSize(22);
+    instructionText.setFillColor(sf::Color::White);
+    instructionText.setOutlineColor(sf::Color::Black);
+    instructionText.setOutlineThickness(2);
+    instructionText.setPosition(sf::Vector2f(230, 480));
+    
+    int selectedSetting = 0; // 0 = música, 1 = sfx
+    
+    while (window.isOpen()) {
+        while (const auto event = window.pollEvent()) {
+            if (event->is<sf::Event::Closed>()) {
+                window.close();
+                return;
+            }
+            
+            if (const auto* keyPressed = event->getIf<sf::Event::KeyPressed>()) {
+                if (keyPressed->code == sf::Keyboard::Key::Escape) {
+                    saveConfig(config);
+                    return;
+                } else if (keyPressed->code == sf::Keyboard::Key::Up) {
+                    selectedSetting = 0;
+                } else if (keyPressed->code == sf::Keyboard::Key::Down) {
+                    selectedSetting = 1;
+                } else if (keyPressed->code == sf::Keyboard::Key::Left) {
+                    if (selectedSetting == 0) {
+                        config.musicVolume = std::max(0.0f, config.musicVolume - 5.0f);
+                    } else {
+                        config.sfxVolume = std::max(0.0f, config.sfxVolume - 5.0f);
+                    }
+                } else if (keyPressed->code == sf::Keyboard::Key::Right) {
+                    if (selectedSetting == 0) {
+                        config.musicVolume = std::min(100.0f, config.musicVolume + 5.0f);
+                    } else {
+                        config.sfxVolume = std::min(100.0f, config.sfxVolume + 5.0f);
+                    }
+                }
+            }
+        }
+        
+        musicText.setString("Volumen Musica: " + std::to_string(static_cast<int>(config.musicVolume)) + "%");
+        musicText.setFillColor(selectedSetting == 0 ? sf::Color::Yellow : sf::Color::White);
+        
+        sfxText.setString("Volumen Efectos: " + std::to_string(static_cast<int>(config.sfxVolume)) + "%");
+        sfxText.setFillColor(selectedSetting == 1 ? sf::Color::Yellow : sf::Color::White);
+        
+        window.clear(sf::Color(20, 20, 40));
+        if (hasBackground) {
+            window.draw(bgSprite);
+            window.draw(overlay);
+        }
+        window.draw(titleText);
+        window.draw(musicText);
+        window.draw(sfxText);
+        window.draw(instructionText);
+        window.display();
+        resources.loader.update();
+    }
+}
+
+void showHighScores(sf::RenderWindow& window, GameResources& resources, const GameConfig& config,
+                    GameDifficulty difficulty) {
+    const sf::Vector2f screen = window.getView().getSize();
+    
+    auto font = resources.fonts.get("assets/fonts/Minecraft.ttf");
+    if (!font) {
+        return;
+    }
+    
+    // Cargar fondo
+    auto bgTexture = resources.textures.get("assets/images/Menu principal.png");
+    bool hasBackground = bgTexture != nullptr;
+    sf::Sprite bgSprite(hasBackground ? *bgTexture : resources.textures.placeholder());
+    if (hasBackground) {
+        float scaleX = screen.x / bgTexture->getSize().x;
+        float scaleY = screen.y / bgTexture->getSize().y;
+        bgSprite.setScale(sf::Vector2f(scaleX, scaleY));
+    }
+    
+    sf::Text titleText(*font);
+    titleText.setString("REGISTRO DE RECORD - TOP 10");
+    titleText.setCharacterSize(40);
+    titleText.setFillColor(sf::Color::Yellow);
+    titleText.setPosition(sf::Vector2f(200, 50));
+    
+    // Dificultad mostrada; con izquierda/derecha se cambia de tabla
+    GameDifficulty shown = difficulty;
+    sf::Text difficultyText(*font);
+    difficultyText.setCharacterSize(26);
+    difficultyText.setFillColor(sf::Color(100, 200, 255));
+    
+    std::vector<sf::Text> scoreTexts;
+    auto buildScoreTexts = [&]() {
+        difficultyText.setString(std::string("< ") + getDifficultyName(shown) + " >");
+        difficultyText.setPosition(sf::Vector2f(screen.x / 2.0f - difficultyText.getLocalBounds().size.x / 2.0f, 100));
+        
+        // Las tablas ya están ordenadas: se leen tal cual
+        ScorePage board = config.highScores[shown].all();
+        scoreTexts.clear();
+        
+        // Mostrar siempre 10 lugares
+        for (size_t i = 0; i < HIGH_SCORES_PER_DIFFICULTY; ++i) {
+            std::string scoreStr;
+            
+            if (i < board.count) {
+                const ScoreEntry& entry = board.entries[i];
+                scoreStr = std::to_string(i + 1) + ". " + 
+                          entry.getName() + " - " + 
+                          std::to_string(entry.score) + " pts";
+            } else {
+                scoreStr = std::to_string(i + 1) + ". ---";
+            }
+            
+            sf::Text text(*font);
+            text.setString(scoreStr);
+            text.setCharacterSize(22);
+            
+            if (i == 0) {
+                text.setFillColor(sf::Color(255, 215, 0));
+            } else if (i == 1) {
+                text.setFillColor(sf::Color(192, 192, 192));
+            } else if (i == 2) {
+                text.setFillColor(sf::Color(205, 127, 50));
+            } else {
+                text.setFillColor(sf::Color::White);
+            }
+            
+            text.setPosition(sf::Vector2f(120, 150 + i * 35));
+            scoreTexts.push_back(text);
+        }
+    };
+    buildScoreTexts();
+    
+    sf::Text backText(*font);
+    backText.setString("Flechas: cambiar dificultad - ESC para volver");
+    backText.setCharacterSize(20);
+    backText.setFillColor(sf::Color(200, 200, 200));
+    backText.setPosition(sf::Vector2f(screen.x / 2.0f - backText.getLocalBounds().size.x / 2.0f, 540));
+    
+    while (window.isOpen()) {
+        while (const auto event = window.pollEvent()) {
+            if (event->is<sf::Event::Closed>()) {
+                window.close();
+                return;
+            }
+            
+            if (const auto* keyPressed = event->getIf<sf::Event::KeyPressed>()) {
+                if (keyPressed->code == sf::Keyboard::Key::Escape) {
+                    return;
+                }
+                if (keyPressed->code == sf::Keyboard::Key::Left) {
+                    int count = static_cast<int>(HighScoreTables::keyCount());
+                    shown = static_cast<GameDifficulty>((static_cast<int>(shown) + count - 1) % count);
+                    buildScoreTexts();
+                } else if (keyPressed->code == sf::Keyboard::Key::Right) {
+                    int count = static_cast<int>(HighScoreTables::keyCount());
+                    shown = static_cast<GameDifficulty>((static_cast<int>(shown) + 1) % count);
+                    buildScoreTexts();
+                }
+            }
+        }
+        
+        window.clear(sf::Color(20, 20, 40));
+        window.draw(bgSprite);
+        
+        sf::RectangleShape overlay(screen);
+        overlay.setFillColor(sf::Color(0, 0, 0, 120));
+        window.draw(overlay);
+        
+        window.draw(titleText);
+        window.draw(difficultyText);
+        for (auto& text : scoreTexts) {
+            window.draw(text);
+        }
+        window.draw(backText);
+        window.display();
+        resources.loader.update();
+    }
+}
@@ -1,203 +1,321 @@
 /// Code written by Bordeanu Calin
 
 #include <SFML/Graphics.hpp>
+#include <SFML/Network.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
-#include <vector>
+#include <optional>
+#include <string>
 #include <windows.h>
 
-#define BLOCKS 90
-#define blockSize 7
-
-const int WIDTH = BLOCKS * blockSize;
-const int HEIGHT = BLOCKS * blockSize;
-
-sf::RenderWindow window(sf::VideoMode({WIDTH, HEIGHT}), "Snake");
-
-bool gameOver = false;
+#include "LossyLink.hpp"
+#include "PrimitiveBatch.hpp"
+#include "TronBots.hpp"
+#include "TronCore.hpp"
+#include "TronRollback.hpp"
+
+// Uso: 08_Tron.exe [celdas] [--red bot] [--blue bot]
+//                  [--net red|blue puerto ip:puerto [--lag ms] [--jitter ms] [--loss porcentaje]]
+// Sin --red/--blue juegan personas (rojo con WASD, azul con las flechas); bot
+// puede ser random, flood o voronoi. El torneo entre bots sin ventana está en
+// bench/TronTournament.cpp.
+//
+// --net juega contra otra máquina por UDP con rollback (ver TronRollback.hpp):
+// se elige el color propio, el puerto local y la dirección del rival, y las
+// dos máquinas tienen que usar el mismo tamaño de arena. El jugador local usa
+// WASD o las flechas, o su bot si se pasó --red/--blue para su color. --lag,
+// --jitter y --loss agregan retardo y pérdida a los paquetes salientes para
+// probar en una sola máquina, por ejemplo:
+//   08_Tron.exe --net red 5000 127.0.0.1:5001 --lag 80 --loss 10
+//   08_Tron.exe --net blue 5001 127.0.0.1:5000 --lag 80 --loss 10
+const int DEFAULT_BLOCKS = 90;
+const int MIN_BLOCKS = 10;
+const int MAX_BLOCKS = 1000;
+const int MAX_BLOCK_SIZE = 7;       // Pixeles por celda en arenas chicas
+// Las arenas medianas se escalan para entrar en esta ventana. El lienzo se
+// dibuja sin suavizado y con menos de un pixel por celda habría filas y
+// columnas de estelas que nunca se ven, así que por encima de este tamaño la
+// ventana crece a un pixel por celda.
+const int MAX_WINDOW_SIZE = 900;
+
+const sf::Color PLAYER_COLORS[TRON_PLAYERS] = {sf::Color::Red, sf::Color::Blue};
+
+const float TICK_SECONDS = 0.03f;
 
 int redScore = 0;
 int blueScore = 0;
 
-class Player
+struct NetOptions
 {
-public:
-    std::vector<sf::RectangleShape> body;
+    int player = -1;                // -1: sin red
+    unsigned short localPort = 0;
+    std::string peerHost;
+    unsigned short peerPort = 0;
+    std::uint32_t lag = 0;
+    std::uint32_t jitter = 0;
+    float loss = 0;
+};
 
-    sf::Color defaultColor;
-    sf::Vector2f dir = {0, -1};
+// Dirección de las teclas apretadas; retorna false si no hay ninguna
+bool ReadKeys(bool useWASD, int &dirX, int &dirY)
+{
+    bool pressed = false;
+    if(sf::Keyboard::isKeyPressed(useWASD ? sf::Keyboard::Key::W : sf::Keyboard::Key::Up))    { dirX = 0;  dirY = -1; pressed = true; }
+    if(sf::Keyboard::isKeyPressed(useWASD ? sf::Keyboard::Key::S : sf::Keyboard::Key::Down))  { dirX = 0;  dirY = 1;  pressed = true; }
+    if(sf::Keyboard::isKeyPressed(useWASD ? sf::Keyboard::Key::A : sf::Keyboard::Key::Left))  { dirX = -1; dirY = 0;  pressed = true; }
+    if(sf::Keyboard::isKeyPressed(useWASD ? sf::Keyboard::Key::D : sf::Keyboard::Key::Right)) { dirX = 1;  dirY = 0;  pressed = true; }
+    return pressed;
+}
 
-    void Move()
-    {
-        sf::RectangleShape &head = body[0];
+// Dirección elegida con el teclado (se aplica en el próximo tick)
+void ChangeDir(TronRound &round, int player, bool useWASD)
+{
+    int dirX, dirY;
+    if(ReadKeys(useWASD, dirX, dirY)) round.steer(player, dirX, dirY);
+}
 
-        int x = head.getPosition().x/blockSize;
-        int y = head.getPosition().y/blockSize;
+// Agrega la celda de la cabeza al lote que se pinta en el lienzo de estelas
+void Stamp(const TronRound &round, int player, PrimitiveBatch &stamps)
+{
+    const TronPlayer &p = round.getPlayer(player);
+    stamps.rect({static_cast<float>(p.x), static_cast<float>(p.y)}, {1, 1}, PLAYER_COLORS[player]);
+}
 
-        if(dir.x==0 && dir.y==-1){
-            head.setPosition({x*blockSize, (y-1)*blockSize});
-        }
-        if(dir.x==0 && dir.y==1){
-            head.setPosition({x*blockSize, (y+1)*blockSize});
-        }
-        if(dir.x==1 && dir.y==0){
-            head.setPosition({(x+1)*blockSize, y*blockSize});
-        }
-        if(dir.x==-1 && dir.y==0){
-            head.setPosition({(x-1)*blockSize, y*blockSize});
+// Repinta todo el lienzo desde la arena (al empezar una ronda)
+void Repaint(const OccupancyGrid &grid, sf::RenderTexture &trails, PrimitiveBatch &stamps)
+{
+    trails.clear(sf::Color(0, 0, 0));
+    for(int y = 0; y < grid.getHeight(); ++y)
+    {
+        for(int x = 0; x < grid.getWidth(); ++x)
+        {
+            std::uint8_t owner = grid.get(x, y);
+            if(owner != OccupancyGrid::EMPTY)
+                stamps.rect({static_cast<float>(x), static_cast<float>(y)}, {1, 1}, PLAYER_COLORS[owner - 1]);
         }
     }
+    stamps.flush(trails);
+    trails.display();
+}
 
-    void AddTail()
+// Partida en red: la simulación la lleva TronRollbackSession y acá solo se
+// mueven paquetes y se repintan las celdas que cambiaron (incluidas las que
+// un rollback liberó)
+int PlayOnline(sf::RenderWindow &window, sf::RenderTexture &trails, sf::Sprite &canvas, PrimitiveBatch &stamps,
+               int blocks, const NetOptions &net, bool isBot, TronBot &bot)
+{
+    sf::UdpSocket socket;
+    if(socket.bind(net.localPort) != sf::Socket::Status::Done)
     {
-        sf::RectangleShape newPart;
-        newPart.setFillColor(defaultColor);
-        newPart.setSize({blockSize, blockSize});
-
-        sf::RectangleShape head = body[0];
-
-        int x = head.getPosition().x;
-        int y = head.getPosition().y;
-
-        newPart.setPosition({x, y});
-
-        body.push_back(newPart);
+        std::cout << "No se pudo abrir el puerto " << net.localPort << '\n';
+        return -1;
     }
-
-    void CheckBounds()
+    socket.setBlocking(false);
+    std::optional<sf::IpAddress> peer = sf::IpAddress::resolve(net.peerHost);
+    if(!peer)
     {
-        sf::RectangleShape &head = body[0];
-
-        int x = head.getPosition().x/blockSize;
-        int y = head.getPosition().y/blockSize;
+        std::cout << "Direccion invalida: " << net.peerHost << '\n';
+        return -1;
+    }
 
-        if(x>=BLOCKS) x = 0;
-        if(x<0) x = BLOCKS;
-        if(y>=BLOCKS) y = 0;
-        if(y<0) y = BLOCKS;
+    TronRollbackSession session(blocks, net.player);
+    LossyLink outgoing(net.lag, net.jitter, net.loss, static_cast<std::uint64_t>(net.localPort));
+    std::uint8_t packet[LossyLink::MAX_PACKET];
+    std::uint32_t shownRound = 0xFFFFFFFF;
 
-        x*=blockSize;
-        y*=blockSize;
+    int wantX = session.getRound().getPlayer(net.player).dirX;
+    int wantY = session.getRound().getPlayer(net.player).dirY;
 
-        head.setPosition({x, y});
-    }
+    sf::Clock link;
+    sf::Clock clock;
+    float t = 0;
 
-    void CheckSelfCollision(int &enemyScore)
+    while(window.isOpen())
     {
-        for(int i = 1; i<body.size(); ++i){
-            int x1 = body[0].getPosition().x;
-            int x2 = body[i].getPosition().x;
-
-            int y1 = body[0].getPosition().y;
-            int y2 = body[i].getPosition().y;
+        while(const auto e = window.pollEvent()){
+            if(e->is<sf::Event::Closed>()) window.close();
+        }
 
-            if(x1==x2 && y1==y2){
-                gameOver = true;
-                ++enemyScore;
-                std::cout << "Press 'R' to go to the next round";
-            }
+        std::size_t received = 0;
+        std::optional<sf::IpAddress> sender;
+        unsigned short senderPort = 0;
+        while(socket.receive(packet, sizeof(packet), received, sender, senderPort) == sf::Socket::Status::Done)
+        {
+            session.readPacket(packet, received);
         }
-    }
 
-    void CheckPlayerCollision(Player p, int &enemyScore)
-    {
-        for(int i = 0; i<p.body.size(); ++i){
-            int x1 = body[0].getPosition().x;
-            int x2 = p.body[i].getPosition().x;
+        if(!isBot && !ReadKeys(true, wantX, wantY)) ReadKeys(false, wantX, wantY);
 
-            int y1 = body[0].getPosition().y;
-            int y2 = p.body[i].getPosition().y;
+        std::uint64_t now = static_cast<std::uint64_t>(link.getElapsedTime().asMilliseconds());
+        t += clock.restart().asSeconds();
+        if(t > TICK_SECONDS)
+        {
+            t = 0;
+            if(isBot) bot.choose(session.getRound(), net.player, wantX, wantY);
+            if(!session.advance(wantX, wantY) && session.getConfirmedFrame() == 0)
+                std::cout << "Esperando al rival...\r";
+            std::size_t length = session.writePacket(packet, sizeof(packet));
+            outgoing.send(packet, length, now);
+        }
+        while(std::size_t length = outgoing.receive(now, packet, sizeof(packet)))
+        {
+            socket.send(packet, length, *peer, net.peerPort);
+        }
 
-            if(x1==x2 && y1==y2){
-                gameOver = true;
-                ++enemyScore;
-                std::cout << "Press 'R' to go to the next round";
-            }
+        bool full = session.drainChanges([&](int x, int y, std::uint8_t owner){
+            sf::Color color = owner == OccupancyGrid::EMPTY ? sf::Color(0, 0, 0) : PLAYER_COLORS[owner - 1];
+            stamps.rect({static_cast<float>(x), static_cast<float>(y)}, {1, 1}, color);
+        });
+        if(full) Repaint(session.getRound().getGrid(), trails, stamps);
+        else
+        {
+            stamps.flush(trails);
+            trails.display();
+        }
+
+        if(session.getRoundNumber() != shownRound)
+        {
+            shownRound = session.getRoundNumber();
+            system("cls");
+            std::cout << "Red:  " << session.getScore(0) << '\n';
+            std::cout << "Blue: " << session.getScore(1) << '\n';
+            // Ronda nueva: el jugador sale hacia arriba otra vez
+            wantX = session.getRound().getPlayer(net.player).dirX;
+            wantY = session.getRound().getPlayer(net.player).dirY;
         }
+
+        window.clear(sf::Color(0, 0, 0));
+        window.draw(canvas);
+        window.display();
     }
 
-    void ChangeDir(bool useWASD)
+    const TronNetStats &stats = session.getStats();
+    std::cout << "\nRollbacks: " << stats.rollbacks << ", frames re-simulados: " << stats.resimulatedFrames
+              << ", desincronizaciones: " << stats.desyncs << '\n';
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    int blocks = DEFAULT_BLOCKS;
+    bool isBot[TRON_PLAYERS] = {false, false};
+    TronBot bots[TRON_PLAYERS];
+    NetOptions net;
+    for(int i = 1; i < argc; ++i)
     {
-        if(!useWASD)
+        int player = -1;
+        if(std::strcmp(argv[i], "--red") == 0) player = 0;
+        else if(std::strcmp(argv[i], "--blue") == 0) player = 1;
+        else if(std::strcmp(argv[i], "--net") == 0)
         {
-            if(sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Up) && dir.y!=1)     dir = {0, -1};
-            if(sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Down) && dir.y!=-1)  dir = {0, 1};
-            if(sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Left) && dir.x!=1)   dir = {-1, 0};
-            if(sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Right) && dir.x!=-1) dir = {1, 0};
+            const char *colon = i + 3 < argc ? std::strrchr(argv[i + 3], ':') : nullptr;
+            if(!colon || (std::strcmp(argv[i + 1], "red") != 0 && std::strcmp(argv[i + 1], "blue") != 0))
+            {
+                std::cout << "--net red|blue puerto ip:puerto\n";
+                return -1;
+            }
+            net.player = std::strcmp(argv[i + 1], "red") == 0 ? 0 : 1;
+            net.localPort = static_cast<unsigned short>(std::atoi(argv[i + 2]));
+            net.peerHost.assign(argv[i + 3], static_cast<std::size_t>(colon - argv[i + 3]));
+            net.peerPort = static_cast<unsigned short>(std::atoi(colon + 1));
+            i += 3;
         }
-        else
+        else if(std::strcmp(argv[i], "--lag") == 0 && i + 1 < argc) net.lag = static_cast<std::uint32_t>(std::atoi(argv[++i]));
+        else if(std::strcmp(argv[i], "--jitter") == 0 && i + 1 < argc) net.jitter = static_cast<std::uint32_t>(std::atoi(argv[++i]));
+        else if(std::strcmp(argv[i], "--loss") == 0 && i + 1 < argc) net.loss = static_cast<float>(std::atof(argv[++i]) / 100.0);
+        else blocks = std::clamp(std::atoi(argv[i]), MIN_BLOCKS, MAX_BLOCKS);
+
+        if(player >= 0)
         {
-            if(sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W) && dir.y!=1)  dir = {0, -1};
-            if(sf::Keyboard::isKeyPressed(sf::Keyboard::Key::S) && dir.y!=-1) dir = {0, 1};
-            if(sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A) && dir.x!=1)  dir = {-1, 0};
-            if(sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D) && dir.x!=-1) dir = {1, 0};
+            TronBotKind kind;
+            if(i + 1 >= argc || !parseTronBotName(argv[++i], kind))
+            {
+                std::cout << "Bots: random, flood, voronoi\n";
+                return -1;
+            }
+            isBot[player] = true;
+            bots[player].setKind(kind);
+            bots[player].seed(static_cast<std::uint64_t>(player + 1));
         }
     }
 
-    void Draw()
-    {
-        for(int i = 0; i<body.size(); ++i)
-            window.draw(body[i]);
-    }
+    unsigned windowSize = static_cast<unsigned>(std::max(blocks, std::min(blocks * MAX_BLOCK_SIZE, MAX_WINDOW_SIZE)));
+    sf::RenderWindow window(sf::VideoMode({windowSize, windowSize}), "Snake");
 
-    void Update(Player enemy, int &enemyScore)
-    {
-        Move();
-        CheckSelfCollision(enemyScore);
-        CheckPlayerCollision(enemy, enemyScore);
-        AddTail();
-        CheckBounds();
-    }
+    // Lienzo de estelas: un texel por celda, se conserva entre frames y cada
+    // tick solo se pintan las celdas nuevas de las cabezas. Se dibuja escalado
+    // a la ventana, así que un frame cuesta lo mismo sin importar el largo de
+    // las estelas ni el tamaño de la arena.
+    sf::RenderTexture trails;
+    if(!trails.resize({static_cast<unsigned>(blocks), static_cast<unsigned>(blocks)})) return -1;
+    sf::Sprite canvas(trails.getTexture());
+    float cellSize = static_cast<float>(windowSize) / blocks;
+    canvas.setScale({cellSize, cellSize});
+    PrimitiveBatch stamps;
 
-    Player(sf::Color Color, sf::Vector2f Position)
-    {
-        sf::RectangleShape head;
+    if(net.player >= 0) return PlayOnline(window, trails, canvas, stamps, blocks, net, isBot[net.player], bots[net.player]);
 
-        defaultColor = Color;
-        head.setFillColor(Color);
-        head.setSize({blockSize, blockSize});
-        head.setPosition(Position);
-        body.push_back(head);
-    }
-};
+    // Estado de la ronda: se reinicia en el lugar, sin reservar memoria
+    TronRound round;
 
-int main()
-{
-    gameOver = false;
-    system("cls");
+    // Nueva ronda: arena y lienzo vacíos, jugadores en su posición inicial
+    auto startRound = [&]()
+    {
+        system("cls");
+        round.reset(blocks, blocks);
 
-    Player p1(sf::Color::Red, {WIDTH/4, HEIGHT/2});
-    Player p2(sf::Color::Blue, {WIDTH-WIDTH/4, HEIGHT/2});
+        trails.clear(sf::Color(0, 0, 0));
+        for(int i = 0; i < TRON_PLAYERS; ++i) Stamp(round, i, stamps);
+        stamps.flush(trails);
+        trails.display();
+
+        std::cout << "Red:  " << redScore  << '\n';
+        std::cout << "Blue: " << blueScore << '\n';
+    };
+    startRound();
 
     sf::Clock clock;
     float t = 0;
 
-    std::cout << "Red:  " << redScore  << '\n';
-    std::cout << "Blue: " << blueScore << '\n';
-
     while(window.isOpen())
     {
         while(const auto e = window.pollEvent()){
             if(e->is<sf::Event::Closed>()) window.close();
-            if(gameOver && sf::Keyboard::isKeyPressed(sf::Keyboard::Key::R)) main();
+            if(round.isOver() && sf::Keyboard::isKeyPressed(sf::Keyboard::Key::R)) startRound();
         }
 
         sf::Time time = clock.restart();
         t+=time.asSeconds();
 
-        if(!gameOver)
+        if(!round.isOver())
         {
-            p1.ChangeDir(true);
-            p2.ChangeDir(false);
-            if(t>0.03){
+            if(!isBot[0]) ChangeDir(round, 0, true);
+            if(!isBot[1]) ChangeDir(round, 1, false);
+            if(t>TICK_SECONDS){
                 t = 0;
-                p1.Update(p2, blueScore);
-                p2.Update(p1, redScore);
+                for(int i = 0; i < TRON_PLAYERS; ++i)
+                {
+                    if(isBot[i]) bots[i].think(round, i);
+                }
+                round.tick();
+                for(int i = 0; i < TRON_PLAYERS; ++i) Stamp(round, i, stamps);
+                stamps.flush(trails);
+                trails.display();
+
+                if(round.isOver())
+                {
+                    // Cada choque suma un punto al rival (en un empate, a los dos)
+                    if(!round.getPlayer(0).alive) ++blueScore;
+                    if(!round.getPlayer(1).alive) ++redScore;
+                    std::cout << "Press 'R' to go to the next round";
+                }
             }
         }
 
         window.clear(sf::Color(0, 0, 0));
-        p1.Draw();
-        p2.Draw();
+        window.draw(canvas);
         window.display();
     }
 }
@@ -4,56 +4,106 @@
 #include <ctime>
 #include <algorithm>
 
+#include "PrimitiveBatch.hpp"
+#include "ShapeMesh.hpp"
+
 const int WINDOW_WIDTH = 1000;
 const int WINDOW_HEIGHT = 400;
 const int GROUND_HEIGHT = 50;
 const float GRAVITY = 0.6f;
 const float JUMP_STRENGTH = -13.0f;
 
+// Poses del dino y cuadros del ave: cada una es una malla armada al arrancar
+enum class DinoPose { RUN_A, RUN_B, JUMP, DUCK };
+const int DINO_POSES = 4;
+const int BIRD_FRAMES = 2;
+
+// Tamaños de cactus (el doble son dos cactus medianos juntos)
+enum class CactusSize { SMALL, MEDIUM, LARGE };
+const int CACTUS_SIZES = 3;
+const sf::Vector2f CACTUS_DIMENSIONS[CACTUS_SIZES] = {{20, 40}, {25, 50}, {30, 60}};
+
+const sf::Color DINO_COLOR(80, 80, 80);
+const sf::Color BIRD_COLOR(64, 64, 64);
+const sf::Color BEAK_COLOR(255, 165, 0);
+const sf::Color CACTUS_COLOR(34, 139, 34); // Verde para cactus
+const sf::Color CLOUD_COLOR(200, 200, 200);
+
+// Mallas de todas las figuras compuestas, en coordenadas relativas a la
+// posición de la entidad. Se dibujan copiándolas en un PrimitiveBatch, así
+// todas las entidades de una capa salen en una sola llamada de dibujo.
+struct DinoRunMeshes {
+    ShapeMesh dino[DINO_POSES];
+    ShapeMesh bird[BIRD_FRAMES];
+    ShapeMesh cactus[CACTUS_SIZES];
+    ShapeMesh cloud;
+};
+
+void buildMeshes(DinoRunMeshes& meshes) {
+    PrimitiveBatch builder;
+
+    // Dino: relativo a la esquina del cuerpo (50x50). Orden de dibujo: cola,
+    // cuerpo, piernas, brazo, cabeza y ojo.
+    for (int pose = 0; pose < DINO_POSES; ++pose) {
+        if (static_cast<DinoPose>(pose) == DinoPose::DUCK) {
+            builder.rect(sf::Vector2f(-10, 25), sf::Vector2f(15, 12), DINO_COLOR);
+            builder.rect(sf::Vector2f(0, 0), sf::Vector2f(50, 50), DINO_COLOR);
+            builder.rect(sf::Vector2f(10, 50), sf::Vector2f(12, 15), DINO_COLOR);
+            builder.rect(sf::Vector2f(30, 50), sf::Vector2f(12, 15), DINO_COLOR);
+            builder.rect(sf::Vector2f(10, 35), sf::Vector2f(8, 25), DINO_COLOR);
+            builder.rect(sf::Vector2f(15, 20), sf::Vector2f(35, 30), DINO_COLOR);
+            builder.rect(sf::Vector2f(40, 25), sf::Vector2f(4, 4), sf::Color::White);
+        } else {
+            // Al correr, las piernas se turnan para levantarse 5 pixeles
+            float leg1Lift = static_cast<DinoPose>(pose) == DinoPose::RUN_B ? 5.0f : 0.0f;
+            float leg2Lift = static_cast<DinoPose>(pose) == DinoPose::RUN_A ? 5.0f : 0.0f;
+            builder.rect(sf::Vector2f(-10, 15), sf::Vector2f(15, 12), DINO_COLOR);
+            builder.rect(sf::Vector2f(0, 0), sf::Vector2f(50, 50), DINO_COLOR);
+            builder.rect(sf::Vector2f(8, 50 - leg1Lift), sf::Vector2f(12, 25), DINO_COLOR);
+            builder.rect(sf::Vector2f(30, 50 - leg2Lift), sf::Vector2f(12, 25), DINO_COLOR);
+            builder.rect(sf::Vector2f(5, 10), sf::Vector2f(8, 25), DINO_COLOR);
+            builder.rect(sf::Vector2f(15, -25), sf::Vector2f(35, 30), DINO_COLOR);
+            builder.rect(sf::Vector2f(40, -18), sf::Vector2f(4, 4), sf::Color::White);
+        }
+        meshes.dino[pose].bake(builder);
+    }
+
+    // Ave: relativo al cuerpo (30x15), alas arriba o abajo según el cuadro
+    for (int frame = 0; frame < BIRD_FRAMES; ++frame) {
+        float wingLift = frame == 0 ? 0.0f : 3.0f;
+        builder.rect(sf::Vector2f(5, -5 + wingLift), sf::Vector2f(20, 8), BIRD_COLOR);
+        builder.rect(sf::Vector2f(5, 15 - wingLift), sf::Vector2f(20, 8), BIRD_COLOR);
+        builder.rect(sf::Vector2f(0, 0), sf::Vector2f(30, 15), BIRD_COLOR);
+        builder.rect(sf::Vector2f(30, 5), sf::Vector2f(8, 5), BEAK_COLOR);
+        meshes.bird[frame].bake(builder);
+    }
+
+    // Cactus con sus espinas laterales
+    for (int size = 0; size < CACTUS_SIZES; ++size) {
+        sf::Vector2f dimensions = CACTUS_DIMENSIONS[size];
+        builder.rect(sf::Vector2f(0, 0), dimensions, CACTUS_COLOR);
+        builder.rect(sf::Vector2f(-5, dimensions.y * 0.3f), sf::Vector2f(8, 15), CACTUS_COLOR);
+        builder.rect(sf::Vector2f(dimensions.x - 3, dimensions.y * 0.5f), sf::Vector2f(8, 15), CACTUS_COLOR);
+        meshes.cactus[size].bake(builder);
+    }
+
+    // Nube: tres círculos (por centro; antes se ubicaban por la esquina)
+    builder.circle(sf::Vector2f(15, 15), 15, CLOUD_COLOR);
+    builder.circle(sf::Vector2f(35, 15), 20, CLOUD_COLOR);
+    builder.circle(sf::Vector2f(50, 15), 15, CLOUD_COLOR);
+    meshes.cloud.bake(builder);
+}
+
 class Dino {
 public:
-    sf::RectangleShape body;
-    sf::RectangleShape head;
-    sf::RectangleShape eye;
-    sf::RectangleShape arm;
-    sf::RectangleShape tail;
-    sf::RectangleShape leg1;
-    sf::RectangleShape leg2;
+    sf::Vector2f position;  // Esquina superior izquierda del cuerpo
     float velocityY;
     bool isJumping;
     bool isDucking;
     int animationFrame;
     sf::Clock animationClock;
 
-    Dino(float x, float y) {
-        // Cuerpo
-        body.setSize(sf::Vector2f(50, 50));
-        body.setPosition(sf::Vector2f(x, y));
-        body.setFillColor(sf::Color(80, 80, 80));
-
-        // Cabeza
-        head.setSize(sf::Vector2f(35, 30));
-        head.setFillColor(sf::Color(80, 80, 80));
-
-        // Ojo
-        eye.setSize(sf::Vector2f(4, 4));
-        eye.setFillColor(sf::Color::White);
-
-        // Brazo
-        arm.setSize(sf::Vector2f(8, 25));
-        arm.setFillColor(sf::Color(80, 80, 80));
-
-        // Cola
-        tail.setSize(sf::Vector2f(15, 12));
-        tail.setFillColor(sf::Color(80, 80, 80));
-
-        // Piernas
-        leg1.setSize(sf::Vector2f(12, 25));
-        leg1.setFillColor(sf::Color(80, 80, 80));
-
-        leg2.setSize(sf::Vector2f(12, 25));
-        leg2.setFillColor(sf::Color(80, 80, 80));
-
+    Dino(float x, float y) : position(x, y) {
         velocityY = 0;
         isJumping = false;
         isDucking = false;
@@ -77,11 +127,11 @@ public:
         // Aplicar gravedad
         if (isJumping) {
             velocityY += GRAVITY;
-            body.move(sf::Vector2f(0, velocityY));
+            position.y += velocityY;
 
             // Verificar si tocó el suelo
-            if (body.getPosition().y >= groundY) {
-                body.setPosition(sf::Vector2f(body.getPosition().x, groundY));
+            if (position.y >= groundY) {
+                position.y = groundY;
                 velocityY = 0;
                 isJumping = false;
             }
@@ -92,61 +142,21 @@ public:
             animationFrame = (animationFrame + 1) % 2;
             animationClock.restart();
         }
+    }
 
-        float bodyX = body.getPosition().x;
-        float bodyY = body.getPosition().y;
-
-        if (isDucking) {
-            // Posición agachado
-            head.setPosition(sf::Vector2f(bodyX + 15, bodyY + 20));
-            eye.setPosition(sf::Vector2f(bodyX + 40, bodyY + 25));
-            arm.setPosition(sf::Vector2f(bodyX + 10, bodyY + 35));
-            tail.setPosition(sf::Vector2f(bodyX - 10, bodyY + 25));
-            
-            leg1.setSize(sf::Vector2f(12, 15));
-            leg2.setSize(sf::Vector2f(12, 15));
-            leg1.setPosition(sf::Vector2f(bodyX + 10, bodyY + 50));
-            leg2.setPosition(sf::Vector2f(bodyX + 30, bodyY + 50));
-        } else {
-            // Posición normal
-            head.setPosition(sf::Vector2f(bodyX + 15, bodyY - 25));
-            eye.setPosition(sf::Vector2f(bodyX + 40, bodyY - 18));
-            arm.setPosition(sf::Vector2f(bodyX + 5, bodyY + 10));
-            tail.setPosition(sf::Vector2f(bodyX - 10, bodyY + 15));
-
-            leg1.setSize(sf::Vector2f(12, 25));
-            leg2.setSize(sf::Vector2f(12, 25));
-
-            // Actualizar posición de piernas con animación
-            float legY = bodyY + body.getSize().y;
-            if (isJumping) {
-                leg1.setPosition(sf::Vector2f(bodyX + 8, legY));
-                leg2.setPosition(sf::Vector2f(bodyX + 30, legY));
-            } else {
-                if (animationFrame == 0) {
-                    leg1.setPosition(sf::Vector2f(bodyX + 8, legY));
-                    leg2.setPosition(sf::Vector2f(bodyX + 30, legY - 5));
-                } else {
-                    leg1.setPosition(sf::Vector2f(bodyX + 8, legY - 5));
-                    leg2.setPosition(sf::Vector2f(bodyX + 30, legY));
-                }
-            }
-        }
+    DinoPose getPose() const {
+        if (isDucking) return DinoPose::DUCK;
+        if (isJumping) return DinoPose::JUMP;
+        return animationFrame == 0 ? DinoPose::RUN_A : DinoPose::RUN_B;
     }
 
-    void draw(sf::RenderWindow& window) {
-        window.draw(tail);
-        window.draw(body);
-        window.draw(leg1);
-        window.draw(leg2);
-        window.draw(arm);
-        window.draw(head);
-        window.draw(eye);
+    void draw(PrimitiveBatch& batch, const DinoRunMeshes& meshes) const {
+        meshes.dino[static_cast<int>(getPose())].addTo(batch, position);
     }
 
     sf::FloatRect getBounds() {
         // Crear hitbox más precisa
-        sf::FloatRect bounds = body.getGlobalBounds();
+        sf::FloatRect bounds(position, sf::Vector2f(50, 50));
         bounds.size.x -= 10; // Reducir un poco el ancho
         bounds.size.y -= 5;  // Reducir un poco la altura
         bounds.position.x += 5;
@@ -154,7 +164,7 @@ public:
         
         if (isDucking) {
             bounds.size.y = 40; // Altura reducida al agacharse
-            bounds.position.y = body.getPosition().y + 25;
+            bounds.position.y = position.y + 25;
         }
         
         return bounds;
@@ -163,53 +173,29 @@ public:
 
 class Obstacle {
 public:
-    sf::RectangleShape shape;
+    sf::Vector2f position;
+    CactusSize size;
     float speed;
-    bool isCactus;
 
-    Obstacle(float x, float y, float width, float height, bool cactus = true) {
-        shape.setSize(sf::Vector2f(width, height));
-        shape.setPosition(sf::Vector2f(x, y));
-        shape.setFillColor(sf::Color(34, 139, 34)); // Verde para cactus
+    Obstacle(float x, float y, CactusSize cactusSize) : position(x, y), size(cactusSize) {
         speed = 6.0f;
-        isCactus = cactus;
     }
 
     void update() {
-        shape.move(sf::Vector2f(-speed, 0));
+        position.x -= speed;
     }
 
-    void draw(sf::RenderWindow& window) {
-        window.draw(shape);
-        
-        // Dibujar espinas del cactus
-        if (isCactus) {
-            float x = shape.getPosition().x;
-            float y = shape.getPosition().y;
-            float w = shape.getSize().x;
-            float h = shape.getSize().y;
-            
-            // Espinas laterales
-            sf::RectangleShape spike1(sf::Vector2f(8, 15));
-            spike1.setPosition(sf::Vector2f(x - 5, y + h * 0.3f));
-            spike1.setFillColor(sf::Color(34, 139, 34));
-            
-            sf::RectangleShape spike2(sf::Vector2f(8, 15));
-            spike2.setPosition(sf::Vector2f(x + w - 3, y + h * 0.5f));
-            spike2.setFillColor(sf::Color(34, 139, 34));
-            
-            window.draw(spike1);
-            window.draw(spike2);
-        }
+    void draw(PrimitiveBatch& batch, const DinoRunMeshes& meshes) const {
+        meshes.cactus[static_cast<int>(size)].addTo(batch, position);
     }
 
     bool isOffScreen() const {
-        return shape.getPosition().x + shape.getSize().x < 0;
+        return position.x + CACTUS_DIMENSIONS[static_cast<int>(size)].x < 0;
     }
 
     sf::FloatRect getBounds() const {
         // Hitbox más precisa
-        sf::FloatRect bounds = shape.getGlobalBounds();
+        sf::FloatRect bounds(position, CACTUS_DIMENSIONS[static_cast<int>(size)]);
         bounds.size.x -= 8;
         bounds.size.y -= 8;
         bounds.position.x += 4;
@@ -220,70 +206,36 @@ public:
 
 class Bird {
 public:
-    sf::RectangleShape body;
-    sf::RectangleShape wing1;
-    sf::RectangleShape wing2;
-    sf::RectangleShape beak;
+    sf::Vector2f position;  // Esquina superior izquierda del cuerpo (30x15)
     float speed;
     int animationFrame;
     sf::Clock animationClock;
-    float yPos;
-
-    Bird(float x, float y) {
-        yPos = y;
-        body.setSize(sf::Vector2f(30, 15));
-        body.setPosition(sf::Vector2f(x, y));
-        body.setFillColor(sf::Color(64, 64, 64));
-
-        wing1.setSize(sf::Vector2f(20, 8));
-        wing1.setFillColor(sf::Color(64, 64, 64));
-
-        wing2.setSize(sf::Vector2f(20, 8));
-        wing2.setFillColor(sf::Color(64, 64, 64));
-
-        beak.setSize(sf::Vector2f(8, 5));
-        beak.setFillColor(sf::Color(255, 165, 0));
 
+    Bird(float x, float y) : position(x, y) {
         speed = 7.0f;
         animationFrame = 0;
     }
 
     void update() {
-        body.move(sf::Vector2f(-speed, 0));
+        position.x -= speed;
         
         // Animación de alas
         if (animationClock.getElapsedTime().asSeconds() > 0.1f) {
-            animationFrame = (animationFrame + 1) % 2;
+            animationFrame = (animationFrame + 1) % BIRD_FRAMES;
             animationClock.restart();
         }
-
-        float x = body.getPosition().x;
-        float y = body.getPosition().y;
-
-        beak.setPosition(sf::Vector2f(x + 30, y + 5));
-
-        if (animationFrame == 0) {
-            wing1.setPosition(sf::Vector2f(x + 5, y - 5));
-            wing2.setPosition(sf::Vector2f(x + 5, y + 15));
-        } else {
-            wing1.setPosition(sf::Vector2f(x + 5, y - 2));
-            wing2.setPosition(sf::Vector2f(x + 5, y + 12));
-        }
     }
 
-    void draw(sf::RenderWindow& window) {
-        window.draw(wing1);
-        window.draw(wing2);
-        window.draw(body);
-        window.draw(beak);
+    void draw(PrimitiveBatch& batch, const DinoRunMeshes& meshes) const {
+        meshes.bird[animationFrame].addTo(batch, position);
     }
 
     bool isOffScreen() const {
-        return body.getPosition().x + body.getSize().x < 0;
+        return position.x + 30 < 0;
     }
 
     sf::FloatRect getBounds() const {
-        sf::FloatRect bounds = body.getGlobalBounds();
+        sf::FloatRect bounds(position, sf::Vector2f(30, 15));
         bounds.size.x -= 6;
         bounds.size.y -= 4;
         bounds.position.x += 3;
@@ -294,31 +246,13 @@ public:
 
 class Cloud {
 public:
-    sf::CircleShape shape1;
-    sf::CircleShape shape2;
-    sf::CircleShape shape3;
     float speed;
     float x, y;
 
     Cloud(float posX, float posY) {
         x = posX;
         y = posY;
-        shape1.setRadius(15);
-        shape2.setRadius(20);
-        shape3.setRadius(15);
-        
-        shape1.setFillColor(sf::Color(200, 200, 200));
-        shape2.setFillColor(sf::Color(200, 200, 200));
-        shape3.setFillColor(sf::Color(200, 200, 200));
-        
         speed = 1.0f;
-        updatePosition();
-    }
-
-    void updatePosition() {
-        shape1.setPosition(sf::Vector2f(x, y));
-        shape2.setPosition(sf::Vector2f(x + 15, y - 5));
-        shape3.setPosition(sf::Vector2f(x + 35, y));
     }
 
     void update() {
@@ -326,13 +260,10 @@ public:
         if (x + 65 < 0) {
             x = WINDOW_WIDTH;
         }
-        updatePosition();
     }
 
-    void draw(sf::RenderWindow& window) {
-        window.draw(shape1);
-        window.draw(shape2);
-        window.draw(shape3);
+    void draw(PrimitiveBatch& batch, const DinoRunMeshes& meshes) const {
+        meshes.cloud.addTo(batch, sf::Vector2f(x, y));
     }
 };
 
@@ -343,6 +274,12 @@ int main() {
     window.setFramerateLimit(60);
 
     float groundY = WINDOW_HEIGHT - GROUND_HEIGHT - 70;
+
+    // Figuras compuestas teseladas una vez; cada frame solo se copian desplazadas
+    DinoRunMeshes meshes;
+    buildMeshes(meshes);
+    PrimitiveBatch sky;     // Nubes (detrás del suelo)
+    PrimitiveBatch actors;  // Dino, cactus y aves
     
     // Crear dino
     Dino dino(100, groundY);
@@ -448,14 +385,14 @@ int main() {
                     birds.push_back(Bird(WINDOW_WIDTH, birdY));
                 } else if (enemyType < 6) {
                     // Cactus pequeño
-                    obstacles.push_back(Obstacle(WINDOW_WIDTH, groundY + 35, 20, 40, true));
+                    obstacles.push_back(Obstacle(WINDOW_WIDTH, groundY + 35, CactusSize::SMALL));
                 } else if (enemyType < 8) {
                     // Cactus doble
-                    obstacles.push_back(Obstacle(WINDOW_WIDTH, groundY + 25, 25, 50, true));
-                    obstacles.push_back(Obstacle(WINDOW_WIDTH + 30, groundY + 25, 25, 50, true));
+                    obstacles.push_back(Obstacle(WINDOW_WIDTH, groundY + 25, CactusSize::MEDIUM));
+                    obstacles.push_back(Obstacle(WINDOW_WIDTH + 30, groundY + 25, CactusSize::MEDIUM));
                 } else {
                     // Cactus grande
-                    obstacles.push_back(Obstacle(WINDOW_WIDTH, groundY + 15, 30, 60, true));
+                    obstacles.push_back(Obstacle(WINDOW_WIDTH, groundY + 15, CactusSize::LARGE));
                 }
                 
                 // Tiempo aleatorio para el siguiente obstáculo (más rápido conforme avanza)
@@ -526,10 +463,11 @@ int main() {
         // Dibujar
         window.clear(sf::Color(247, 247, 247)); // Fondo gris claro
 
-        // Dibujar nubes
+        // Dibujar nubes (una sola llamada)
         for (auto& cloud : clouds) {
-            cloud.draw(window);
+            cloud.draw(sky, meshes);
         }
+        sky.flush(window);
 
         // Dibujar suelo
         window.draw(ground);
@@ -537,18 +475,15 @@ int main() {
             window.draw(line);
         }
 
-        // Dibujar dino
-        dino.draw(window);
-
-        // Dibujar obstáculos
+        // Dibujar dino, obstáculos y aves (una sola llamada para todos)
+        dino.draw(actors, meshes);
         for (auto& obstacle : obstacles) {
-            obstacle.draw(window);
+            obstacle.draw(actors, meshes);
         }
-
-        // Dibujar aves
         for (auto& bird : birds) {
-            bird.draw(window);
+            bird.draw(actors, meshes);
         }
+        actors.flush(window);
 
         // Dibujar puntaje
         if (fontLoaded) {
@@ -5,12 +5,34 @@
 #include <algorithm>
 #include <cmath>
 
+#include "AnimationClip.hpp"
+#include "ParallaxBackground.hpp"
+#include "ParticleBatch.hpp"
+#include "Random.hpp"
+#include "ShapeMesh.hpp"
+#include "TimerWheel.hpp"
+
 const int WINDOW_WIDTH = 1000;
 const int WINDOW_HEIGHT = 600;
 const int GROUND_HEIGHT = 50;
 const float GRAVITY = 0.5f;
 const float JUMP_STRENGTH = -12.0f;
 
+// El juego avanza un tick por frame (60 FPS). Cooldowns, animación, spawn y
+// puntaje son temporizadores de la rueda, así que se congelan en game over.
+const int TICKS_PER_SECOND = 60;
+const std::uint64_t DINO_FRAME_TICKS = 7;       // ~0.12 s por frame de animación
+const std::uint64_t SHOOT_COOLDOWN_TICKS = 15;  // 0.25 s entre disparos
+const std::uint64_t DAMAGE_FLASH_TICKS = 6;     // 0.1 s de parpadeo al recibir daño
+const std::uint64_t SCORE_TICKS = 6;            // +1 punto cada 0.1 s
+
+enum class TimerEvent : std::uint16_t {
+    COOLDOWN,          // Solo marca un intervalo; se consulta con isPending()
+    SPAWN_ENEMY,
+    SCORE_POINT,
+    DINO_ANIMATION
+};
+
 class Projectile {
 public:
     sf::CircleShape shape;
@@ -70,16 +92,11 @@ public:
     bool isDucking;
     int animationFrame;
     int facingDirection; // 1 = derecha, -1 = izquierda
-    sf::Clock animationClock;
-    sf::Clock shootClock;
-    int numFrames;
+    TimerHandle shootCooldown;
+    AnimationClip walkClip;   // Rectángulos de los 4 frames, calculados una vez
     float spriteScale;
 
     Dino(float startX, float startY) : sprite(walkTexture) {
-        x = startX;
-        y = startY;
-        facingDirection = 1;
-        numFrames = 4;
         spriteScale = 0.6f; // Ajustado para estar al nivel de los cactus
         
         // Cargar textura
@@ -87,21 +104,34 @@ public:
             // Error al cargar textura
         }
         
-        sprite.setTexture(walkTexture);
-        sprite.setScale(sf::Vector2f(spriteScale, spriteScale));
+        sprite.setTexture(walkTexture, true);
         
-        // Configurar el primer frame
-        sf::Vector2u texSize = walkTexture.getSize();
-        int frameWidth = texSize.x / numFrames;
-        sprite.setTextureRect(sf::IntRect(sf::Vector2i(0, 0), sf::Vector2i(frameWidth, texSize.y)));
+        // Frames de la hoja
+        walkClip = makeAnimationClip(sf::IntRect(sf::Vector2i(0, 0), sf::Vector2i(walkTexture.getSize())), 4, 0.12f, spriteScale);
         
         // Establecer origen en la base completa (100% abajo)
-        sprite.setOrigin(sf::Vector2f(frameWidth / 2.0f, texSize.y));
+        sprite.setOrigin(walkClip.origin);
 
+        reset(startX, startY);
+    }
+
+    // El sprite apunta a walkTexture de este objeto: no se copia, se reinicia
+    Dino(const Dino&) = delete;
+    Dino& operator=(const Dino&) = delete;
+
+    // Vuelve al estado inicial sin recargar la textura
+    void reset(float startX, float startY) {
+        x = startX;
+        y = startY;
+        facingDirection = 1;
         velocityY = 0;
         isJumping = false;
         isDucking = false;
         animationFrame = 0;
+        shootCooldown = TimerHandle();
+        sprite.setTextureRect(walkClip.frames[0]);
+        sprite.setScale(sf::Vector2f(spriteScale, spriteScale));
+        sprite.setPosition(sf::Vector2f(x, y));
     }
 
     void jump() {
@@ -148,35 +178,27 @@ public:
             }
         }
 
-        // Configurar sprite (siempre usa walkTexture)
-        sprite.setTexture(walkTexture);
-        sprite.setScale(sf::Vector2f(spriteScale, spriteScale));
-        sf::Vector2u texSize = walkTexture.getSize();
-        int frameWidth = texSize.x / numFrames;
-        sprite.setOrigin(sf::Vector2f(frameWidth / 2.0f, texSize.y)); // Origen en la base 100%
-        
-        // Animación de frames
-        if (animationClock.getElapsedTime().asSeconds() > 0.12f && !isJumping) {
-            animationFrame = (animationFrame + 1) % numFrames;
-            sprite.setTextureRect(sf::IntRect(sf::Vector2i(animationFrame * frameWidth, 0), sf::Vector2i(frameWidth, texSize.y)));
-            animationClock.restart();
-        }
-        
         // Voltear sprite según dirección
-        if (facingDirection == -1) {
-            sprite.setScale(sf::Vector2f(-spriteScale, spriteScale));
-        }
+        sprite.setScale(sf::Vector2f(spriteScale * facingDirection, spriteScale));
         
         // Actualizar posición del sprite
         sprite.setPosition(sf::Vector2f(x, y));
     }
 
-    bool canShoot() {
-        return shootClock.getElapsedTime().asSeconds() > 0.25f;
+    // Paso de animación (evento DINO_ANIMATION); en el aire se queda en el frame actual
+    void nextFrame() {
+        if (!isJumping) {
+            animationFrame = (animationFrame + 1) % static_cast<int>(walkClip.getFrameCount());
+            sprite.setTextureRect(walkClip.frames[animationFrame]);
+        }
+    }
+
+    bool canShoot(const TimerWheel& timers) const {
+        return !timers.isPending(shootCooldown);
     }
 
-    void resetShootClock() {
-        shootClock.restart();
+    void startShootCooldown(TimerWheel& timers) {
+        shootCooldown = timers.schedule(SHOOT_COOLDOWN_TICKS, static_cast<std::uint16_t>(TimerEvent::COOLDOWN));
     }
 
     void draw(sf::RenderWindow& window) {
@@ -210,150 +232,142 @@ public:
     }
 };
 
+// Mallas del enemigo: una por tipo, vida (el cuerpo se aclara con cada
+// golpe y con 1 de vida muestra el punto débil), parpadeo de daño y, para el
+// ave, cuadro de aleteo. Se arman al arrancar; dibujar un enemigo es copiar
+// una malla desplazada.
+const int ENEMY_MAX_HEALTH = 3;
+const int WING_FRAMES = 7;          // Desplazamiento de las alas redondeado: -3..3 pixeles
+
+struct EnemyMeshes {
+    ShapeMesh cactus[ENEMY_MAX_HEALTH + 1][2];
+    ShapeMesh bird[ENEMY_MAX_HEALTH + 1][2][WING_FRAMES];
+};
+
+// Color del cuerpo después de bajar de startHealth a health
+sf::Color enemyBodyColor(sf::Color base, int startHealth, int health) {
+    sf::Color color = base;
+    for (int h = startHealth - 1; h >= health; --h) {
+        if (h == 2) {
+            color = sf::Color(color.r + 30, color.g + 30, color.b);
+        } else if (h == 1) {
+            color = sf::Color(color.r + 50, color.g + 50, color.b);
+        }
+    }
+    return color;
+}
+
+void buildEnemyMeshes(EnemyMeshes& meshes) {
+    PrimitiveBatch builder;
+    for (int health = 1; health <= ENEMY_MAX_HEALTH; ++health) {
+        for (int flash = 0; flash < 2; ++flash) {
+            // Cactus enemigo: relativo a la esquina del cuerpo (30x50)
+            sf::Color body = flash ? sf::Color::White : enemyBodyColor(sf::Color(40, 120, 40), 3, health);
+            builder.rect(sf::Vector2f(0, 0), sf::Vector2f(30, 50), body, 2, sf::Color(30, 80, 30));
+            builder.rect(sf::Vector2f(-8, 12), sf::Vector2f(10, 18), sf::Color(40, 120, 40));
+            builder.rect(sf::Vector2f(28, 25), sf::Vector2f(10, 18), sf::Color(40, 120, 40));
+            builder.rect(sf::Vector2f(11, -8), sf::Vector2f(8, 12), sf::Color(40, 120, 40));
+            if (health == 1) {
+                builder.circle(sf::Vector2f(17, 24), 4, sf::Color::Red);
+            }
+            meshes.cactus[health][flash].bake(builder);
+
+            // Ave enemiga: relativo a la esquina del cuerpo (40x25)
+            body = flash ? sf::Color::White : enemyBodyColor(sf::Color(80, 40, 0), 2, health);
+            for (int frame = 0; frame < WING_FRAMES; ++frame) {
+                float wingOffset = static_cast<float>(frame - WING_FRAMES / 2);
+                builder.rect(sf::Vector2f(0, 0), sf::Vector2f(40, 25), body, 2, sf::Color(50, 25, 0));
+                builder.rect(sf::Vector2f(6, -10 + wingOffset), sf::Vector2f(28, 12), sf::Color(60, 30, 0));
+                builder.rect(sf::Vector2f(6, 25 - wingOffset), sf::Vector2f(28, 12), sf::Color(60, 30, 0));
+                builder.rect(sf::Vector2f(40, 10), sf::Vector2f(12, 6), sf::Color(255, 165, 0)); // Pico
+                if (health == 1) {
+                    builder.circle(sf::Vector2f(19, 12), 4, sf::Color::Red);
+                }
+                meshes.bird[health][flash][frame].bake(builder);
+            }
+        }
+    }
+}
+
 class Enemy {
 public:
-    sf::RectangleShape body;
-    sf::RectangleShape spike1;
-    sf::RectangleShape spike2;
-    sf::RectangleShape spike3;
-    sf::CircleShape weak_spot;
+    sf::Vector2f position;     // Esquina superior izquierda del cuerpo
+    sf::Vector2f size;
     float speed;
     int health;
     bool isFlying;
     float baseY;
-    sf::Clock hoverClock;
-    sf::Clock damageClock;
+    std::uint64_t spawnTick;   // Tick de la rueda en que apareció (para el vuelo ondulante)
+    TimerHandle damageFlash;
     bool showDamage;
+    int wingFrame;
 
-    Enemy(float startX, float startY, bool flying = false) {
+    Enemy(float startX, float startY, std::uint64_t tick, bool flying = false) {
+        spawnTick = tick;
         isFlying = flying;
         baseY = startY;
         showDamage = false;
+        wingFrame = WING_FRAMES / 2;
+        position = sf::Vector2f(startX, startY);
         
         if (flying) {
             // Ave enemiga mejorada
-            body.setSize(sf::Vector2f(40, 25));
-            body.setFillColor(sf::Color(80, 40, 0));
-            body.setOutlineColor(sf::Color(50, 25, 0));
-            body.setOutlineThickness(2);
-            
-            spike1.setSize(sf::Vector2f(28, 12));
-            spike1.setFillColor(sf::Color(60, 30, 0));
-            
-            spike2.setSize(sf::Vector2f(28, 12));
-            spike2.setFillColor(sf::Color(60, 30, 0));
-            
-            // Pico
-            spike3.setSize(sf::Vector2f(12, 6));
-            spike3.setFillColor(sf::Color(255, 165, 0));
-            
+            size = sf::Vector2f(40, 25);
             health = 2;
         } else {
             // Cactus enemigo - tamaño ajustado para coincidir con el personaje
-            body.setSize(sf::Vector2f(30, 50));
-            body.setFillColor(sf::Color(40, 120, 40));
-            body.setOutlineColor(sf::Color(30, 80, 30));
-            body.setOutlineThickness(2);
-            
-            spike1.setSize(sf::Vector2f(10, 18));
-            spike1.setFillColor(sf::Color(40, 120, 40));
-            
-            spike2.setSize(sf::Vector2f(10, 18));
-            spike2.setFillColor(sf::Color(40, 120, 40));
-            
-            spike3.setSize(sf::Vector2f(8, 12));
-            spike3.setFillColor(sf::Color(40, 120, 40));
-            
+            size = sf::Vector2f(30, 50);
             health = 3;
         }
-        
-        // Punto débil
-        weak_spot.setRadius(4);
-        weak_spot.setFillColor(sf::Color::Red);
-        
-        body.setPosition(sf::Vector2f(startX, startY));
         speed = 3.5f;
     }
 
-    void update() {
-        body.move(sf::Vector2f(-speed, 0));
+    void update(const TimerWheel& timers) {
+        position.x -= speed;
+        float aliveSeconds = static_cast<float>(timers.now() - spawnTick) / TICKS_PER_SECOND;
         
         if (isFlying) {
             // Efecto de vuelo ondulante más suave
-            float offset = std::sin(hoverClock.getElapsedTime().asSeconds() * 2.5f) * 8.0f;
-            body.setPosition(sf::Vector2f(body.getPosition().x, baseY + offset));
+            position.y = baseY + std::sin(aliveSeconds * 2.5f) * 8.0f;
             
             // Alas con animación
-            float x = body.getPosition().x;
-            float y = body.getPosition().y;
-            float wingOffset = std::sin(hoverClock.getElapsedTime().asSeconds() * 10.0f) * 3.0f;
-            
-            spike1.setPosition(sf::Vector2f(x + 6, y - 10 + wingOffset));
-            spike2.setPosition(sf::Vector2f(x + 6, y + 25 - wingOffset));
-            spike3.setPosition(sf::Vector2f(x + 40, y + 10)); // Pico
-            weak_spot.setPosition(sf::Vector2f(x + 15, y + 8));
-        } else {
-            // Espinas del cactus - ajustadas al tamaño
-            float x = body.getPosition().x;
-            float y = body.getPosition().y;
-            spike1.setPosition(sf::Vector2f(x - 8, y + 12));
-            spike2.setPosition(sf::Vector2f(x + body.getSize().x - 2, y + 25));
-            spike3.setPosition(sf::Vector2f(x + body.getSize().x / 2 - 4, y - 8));
-            weak_spot.setPosition(sf::Vector2f(x + 13, y + 20));
+            float wingOffset = std::sin(aliveSeconds * 10.0f) * 3.0f;
+            wingFrame = static_cast<int>(std::lround(wingOffset)) + WING_FRAMES / 2;
         }
         
         // Efecto de daño
-        if (showDamage && damageClock.getElapsedTime().asSeconds() > 0.1f) {
-            showDamage = false;
-        }
+        showDamage = timers.isPending(damageFlash);
     }
 
-    void takeDamage() {
+    void takeDamage(TimerWheel& timers) {
         health--;
         showDamage = true;
-        damageClock.restart();
-        
-        // Cambiar color cuando recibe daño
-        sf::Color currentColor = body.getFillColor();
-        if (health == 2) {
-            body.setFillColor(sf::Color(currentColor.r + 30, currentColor.g + 30, currentColor.b));
-        } else if (health == 1) {
-            body.setFillColor(sf::Color(currentColor.r + 50, currentColor.g + 50, currentColor.b));
-        }
+        timers.cancel(damageFlash);
+        damageFlash = timers.schedule(DAMAGE_FLASH_TICKS, static_cast<std::uint16_t>(TimerEvent::COOLDOWN));
     }
 
     bool isDead() const {
         return health <= 0;
     }
 
-    void draw(sf::RenderWindow& window) {
-        if (showDamage) {
-            // Parpadeo al recibir daño
-            sf::Color flashColor = sf::Color::White;
-            sf::Color originalColor = body.getFillColor();
-            body.setFillColor(flashColor);
-            window.draw(body);
-            body.setFillColor(originalColor);
+    // Parpadeo al recibir daño: el cuerpo se pinta de blanco
+    void draw(PrimitiveBatch& batch, const EnemyMeshes& meshes) const {
+        int meshHealth = std::clamp(health, 1, ENEMY_MAX_HEALTH);
+        int flash = showDamage ? 1 : 0;
+        if (isFlying) {
+            meshes.bird[meshHealth][flash][wingFrame].addTo(batch, position);
         } else {
-            window.draw(body);
-        }
-        
-        window.draw(spike1);
-        window.draw(spike2);
-        window.draw(spike3);
-        
-        // Mostrar punto débil si tiene poca vida
-        if (health == 1) {
-            window.draw(weak_spot);
+            meshes.cactus[meshHealth][flash].addTo(batch, position);
         }
     }
 
     bool isOffScreen() const {
-        return body.getPosition().x + body.getSize().x < -50;
+        return position.x + size.x < -50;
     }
 
     sf::FloatRect getBounds() const {
-        sf::FloatRect bounds = body.getGlobalBounds();
+        // Mismo rectángulo que el cuerpo con su contorno de 2 pixeles
+        sf::FloatRect bounds(position - sf::Vector2f(2, 2), size + sf::Vector2f(4, 4));
         bounds.size.x -= 8;
         bounds.size.y -= 8;
         bounds.position.x += 4;
@@ -362,52 +376,15 @@ public:
     }
 };
 
-class Explosion {
-public:
-    std::vector<sf::CircleShape> particles;
-    sf::Clock lifeClock;
-    bool active;
-
-    Explosion(float x, float y) {
-        active = true;
-        for (int i = 0; i < 8; i++) {
-            sf::CircleShape particle(4);
-            particle.setPosition(sf::Vector2f(x, y));
-            particle.setFillColor(sf::Color(255, 150 + std::rand() % 100, 0));
-            particles.push_back(particle);
-        }
-    }
-
-    void update() {
-        float time = lifeClock.getElapsedTime().asSeconds();
-        if (time > 0.5f) {
-            active = false;
-            return;
-        }
-
-        for (size_t i = 0; i < particles.size(); i++) {
-            float angle = (i * 45.0f) * 3.14159f / 180.0f;
-            float speed = 3.0f;
-            particles[i].move(sf::Vector2f(std::cos(angle) * speed, std::sin(angle) * speed));
-            
-            // Fade out
-            sf::Color color = particles[i].getFillColor();
-            color.a = static_cast<unsigned char>(255 * (1.0f - time * 2.0f));
-            particles[i].setFillColor(color);
-        }
-    }
-
-    void draw(sf::RenderWindow& window) {
-        if (active) {
-            for (auto& particle : particles) {
-                window.draw(particle);
-            }
-        }
-    }
-};
+// Todas las explosiones comparten un solo sistema de partículas
+const std::size_t MAX_PARTICLES = 256;
+const float PARTICLE_TIMESTEP = 1.0f / 60.0f; // Se actualiza una vez por frame a 60 FPS
 
 int main() {
-    std::srand(static_cast<unsigned>(std::time(nullptr)));
+    // Generador propio en lugar de rand(): enemigos y partículas salen de la
+    // misma semilla, con flujos separados
+    std::uint64_t seed = static_cast<std::uint64_t>(std::time(nullptr));
+    Xoshiro128 random(deriveSeed(seed, 1));
     
     sf::RenderWindow window(sf::VideoMode({WINDOW_WIDTH, WINDOW_HEIGHT}), "Dino Revenge");
     window.setFramerateLimit(60);
@@ -415,28 +392,14 @@ int main() {
     // Cargar imagen de fondo
     sf::Texture backgroundTexture;
     bool backgroundLoaded = backgroundTexture.loadFromFile("./assets/images/fondo.png");
-    backgroundTexture.setRepeated(true);
-    sf::Sprite backgroundSprite(backgroundTexture);
-    sf::Sprite backgroundSprite2(backgroundTexture);
     
+    // Fondo en una sola capa de toda la altura (mantiene la proporción) que se
+    // desplaza sobre la textura repetida
     float bgScrollSpeed = 2.0f;
-    float bgX1 = 0.0f;
-    float bgX2 = 0.0f;
-    
+    float bgScroll = 0.0f;
+    ParallaxBackground background(WINDOW_WIDTH);
     if (backgroundLoaded) {
-        // Escalar el fondo manteniendo la proporción
-        sf::Vector2u texSize = backgroundTexture.getSize();
-        float scaleY = static_cast<float>(WINDOW_HEIGHT) / texSize.y;
-        float scaleX = scaleY; // Mantener proporción
-        backgroundSprite.setScale(sf::Vector2f(scaleX, scaleY));
-        backgroundSprite2.setScale(sf::Vector2f(scaleX, scaleY));
-        
-        // Calcular el ancho escalado
-        float scaledWidth = texSize.x * scaleX;
-        bgX2 = scaledWidth;
-        
-        backgroundSprite.setPosition(sf::Vector2f(bgX1, 0));
-        backgroundSprite2.setPosition(sf::Vector2f(bgX2, 0));
+        background.addLayer(backgroundTexture, 1.0f, 0, WINDOW_HEIGHT);
     }
 
     // Posición del suelo (donde el dino camina)
@@ -447,11 +410,24 @@ int main() {
     Dino dino(100, groundY);
     std::vector<Projectile> projectiles;
     std::vector<Enemy> enemies;
-    std::vector<Explosion> explosions;
+    ParticleSystem<MAX_PARTICLES> particles;
+    particles.random.seed(deriveSeed(seed, 2));
+    PrimitiveBatch effects;
+    EnemyMeshes enemyMeshes;
+    buildEnemyMeshes(enemyMeshes);
     
-    sf::Clock enemyClock;
     float nextEnemyTime = 2.0f;
 
+    // Temporizadores del juego; solo avanzan mientras se juega
+    TimerWheel timers(256);
+    auto startTimers = [&]() {
+        timers.clear();
+        timers.schedule(static_cast<std::uint64_t>(nextEnemyTime * TICKS_PER_SECOND), static_cast<std::uint16_t>(TimerEvent::SPAWN_ENEMY));
+        timers.schedule(SCORE_TICKS, static_cast<std::uint16_t>(TimerEvent::SCORE_POINT));
+        timers.schedule(DINO_FRAME_TICKS, static_cast<std::uint16_t>(TimerEvent::DINO_ANIMATION));
+    };
+    startTimers();
+
     // Suelo
     sf::RectangleShape ground(sf::Vector2f(WINDOW_WIDTH, GROUND_HEIGHT));
     ground.setPosition(sf::Vector2f(0, WINDOW_HEIGHT - GROUND_HEIGHT));
@@ -460,7 +436,6 @@ int main() {
     // Puntaje y estadísticas
     int score = 0;
     int enemiesKilled = 0;
-    sf::Clock scoreClock;
     sf::Font font;
     
     bool fontLoaded = font.openFromFile("./assets/fonts/Minecraft.ttf");
@@ -486,6 +461,27 @@ int main() {
     bool gameStarted = false;
     int playerHealth = 3;
 
+    // Crea un enemigo nuevo y elige cuándo sale el siguiente
+    auto spawnEnemy = [&]() {
+        int enemyType = static_cast<int>(random.nextInt(10));
+        
+        if (enemyType < 4) {
+            // Ave voladora - a diferentes alturas alcanzables con salto
+            int height = static_cast<int>(random.nextInt(3));
+            float birdY = groundY - 60 - (height * 25); // Alturas: -60, -85, -110 (más bajas)
+            enemies.push_back(Enemy(WINDOW_WIDTH, birdY, timers.now(), true));
+        } else {
+            // Cactus terrestre - pegado al suelo
+            // El cactus se dibuja desde su posición hacia abajo, así que la posición Y
+            // debe ser groundY menos la altura del cactus para que la base toque el suelo
+            float cactusY = groundY - 50; // groundY menos altura del cactus (50px)
+            enemies.push_back(Enemy(WINDOW_WIDTH, cactusY, timers.now(), false));
+        }
+        
+        nextEnemyTime = 1.5f + static_cast<float>(random.nextInt(100)) / 100.0f;
+        if (score > 500) nextEnemyTime *= 0.85f;
+    };
+
     while (window.isOpen()) {
         // Procesar eventos
         while (const auto event = window.pollEvent()) {
@@ -509,17 +505,17 @@ int main() {
                     
                     // Disparar hacia adelante con X o Ctrl
                     if ((keyEvent->code == sf::Keyboard::Key::X || 
-                         keyEvent->code == sf::Keyboard::Key::LControl) && dino.canShoot()) {
+                         keyEvent->code == sf::Keyboard::Key::LControl) && dino.canShoot(timers)) {
                         sf::Vector2f shootPos = dino.getShootPosition();
                         projectiles.push_back(Projectile(shootPos.x, shootPos.y, dino.getFacingDirection()));
-                        dino.resetShootClock();
+                        dino.startShootCooldown(timers);
                     }
                     
                     // Disparar hacia atrás con Z
-                    if (keyEvent->code == sf::Keyboard::Key::Z && dino.canShoot()) {
+                    if (keyEvent->code == sf::Keyboard::Key::Z && dino.canShoot(timers)) {
                         sf::Vector2f shootPos = dino.getShootPosition();
                         projectiles.push_back(Projectile(shootPos.x, shootPos.y, -dino.getFacingDirection()));
-                        dino.resetShootClock();
+                        dino.startShootCooldown(timers);
                     }
                 } else {
                     // Reiniciar juego
@@ -530,9 +526,10 @@ int main() {
                     playerHealth = 3;
                     enemies.clear();
                     projectiles.clear();
-                    explosions.clear();
-                    dino = Dino(100, groundY);
+                    particles.clear();
+                    dino.reset(100, groundY);
                     nextEnemyTime = 2.0f;
+                    startTimers();
                 }
             }
 
@@ -548,24 +545,9 @@ int main() {
         if (gameStarted && !gameOver) {
             // Actualizar scroll del fondo
             if (backgroundLoaded) {
-                bgX1 -= bgScrollSpeed;
-                bgX2 -= bgScrollSpeed;
-                
-                // Obtener el ancho escalado
-                sf::Vector2u texSize = backgroundTexture.getSize();
-                float scaleY = static_cast<float>(WINDOW_HEIGHT) / texSize.y;
-                float scaledWidth = texSize.x * scaleY;
-                
-                // Reposicionar cuando sale de la pantalla
-                if (bgX1 + scaledWidth <= 0) {
-                    bgX1 = bgX2 + scaledWidth;
-                }
-                if (bgX2 + scaledWidth <= 0) {
-                    bgX2 = bgX1 + scaledWidth;
-                }
-                
-                backgroundSprite.setPosition(sf::Vector2f(bgX1, 0));
-                backgroundSprite2.setPosition(sf::Vector2f(bgX2, 0));
+                // Se reduce a una repetición para que el float no pierda precisión
+                bgScroll = std::fmod(bgScroll + bgScrollSpeed, background.getTileWidth(0));
+                background.setScroll(bgScroll);
             }
             
             // Control de agacharse
@@ -589,28 +571,25 @@ int main() {
             // Actualizar dino
             dino.update(groundY);
 
-            // Crear nuevos enemigos
-            if (enemyClock.getElapsedTime().asSeconds() > nextEnemyTime) {
-                int enemyType = std::rand() % 10;
-                
-                if (enemyType < 4) {
-                    // Ave voladora - a diferentes alturas alcanzables con salto
-                    int height = std::rand() % 3;
-                    float birdY = groundY - 60 - (height * 25); // Alturas: -60, -85, -110 (más bajas)
-                    enemies.push_back(Enemy(WINDOW_WIDTH, birdY, true));
-                } else {
-                    // Cactus terrestre - pegado al suelo
-                    // El cactus se dibuja desde su posición hacia abajo, así que la posición Y
-                    // debe ser groundY menos la altura del cactus para que la base toque el suelo
-                    float cactusY = groundY - 50; // groundY menos altura del cactus (50px)
-                    enemies.push_back(Enemy(WINDOW_WIDTH, cactusY, false));
+            // Un tick de la rueda: animación, puntaje por tiempo y nuevos enemigos
+            timers.advance([&](std::uint16_t event, std::uint32_t) {
+                switch (static_cast<TimerEvent>(event)) {
+                    case TimerEvent::DINO_ANIMATION:
+                        dino.nextFrame();
+                        timers.schedule(DINO_FRAME_TICKS, event);
+                        break;
+                    case TimerEvent::SCORE_POINT:
+                        score++;
+                        timers.schedule(SCORE_TICKS, event);
+                        break;
+                    case TimerEvent::SPAWN_ENEMY:
+                        spawnEnemy();
+                        timers.schedule(static_cast<std::uint64_t>(nextEnemyTime * TICKS_PER_SECOND), event);
+                        break;
+                    default:
+                        break;
                 }
-                
-                nextEnemyTime = 1.5f + static_cast<float>(std::rand() % 100) / 100.0f;
-                if (score > 500) nextEnemyTime *= 0.85f;
-                
-                enemyClock.restart();
-            }
+            });
 
             // Actualizar proyectiles
             for (auto& proj : projectiles) {
@@ -619,14 +598,14 @@ int main() {
                 // Verificar colisión con enemigos
                 for (auto& enemy : enemies) {
                     if (proj.active && proj.getBounds().findIntersection(enemy.getBounds()).has_value()) {
-                        enemy.takeDamage();
+                        enemy.takeDamage(timers);
                         proj.active = false;
                         
                         if (enemy.isDead()) {
-                            explosions.push_back(Explosion(
+                            particles.emit(DINO_CLASSIC_EXPLOSION,
                                 enemy.getBounds().position.x + enemy.getBounds().size.x / 2,
                                 enemy.getBounds().position.y + enemy.getBounds().size.y / 2
-                            ));
+                            );
                             enemiesKilled++;
                             score += 50;
                         }
@@ -643,15 +622,15 @@ int main() {
 
             // Actualizar enemigos
             for (auto& enemy : enemies) {
-                enemy.update();
+                enemy.update(timers);
                 
                 // Verificar colisión con el dino
                 if (enemy.getBounds().findIntersection(dino.getBounds()).has_value()) {
                     playerHealth--;
-                    explosions.push_back(Explosion(
+                    particles.emit(DINO_CLASSIC_EXPLOSION,
                         enemy.getBounds().position.x,
                         enemy.getBounds().position.y
-                    ));
+                    );
                     enemy.health = 0; // Destruir enemigo tras colisión
                     
                     if (playerHealth <= 0) {
@@ -668,21 +647,7 @@ int main() {
             );
 
             // Actualizar explosiones
-            for (auto& explosion : explosions) {
-                explosion.update();
-            }
-
-            explosions.erase(
-                std::remove_if(explosions.begin(), explosions.end(),
-                    [](const Explosion& e) { return !e.active; }),
-                explosions.end()
-            );
-
-            // Actualizar puntaje por tiempo
-            if (scoreClock.getElapsedTime().asSeconds() > 0.1f) {
-                score++;
-                scoreClock.restart();
-            }
+            particles.update(PARTICLE_TIMESTEP);
 
             if (fontLoaded) {
                 scoreText.setString("Score: " + std::to_string(score));
@@ -694,8 +659,7 @@ int main() {
         // Dibujar
         if (backgroundLoaded) {
             window.clear();
-            window.draw(backgroundSprite);
-            window.draw(backgroundSprite2);
+            background.draw(window);
         } else {
             window.clear(sf::Color(135, 206, 235)); // Cielo azul
         }
@@ -711,15 +675,12 @@ int main() {
             proj.draw(window);
         }
 
-        // Dibujar enemigos
+        // Dibujar enemigos y explosiones (una sola llamada para todos)
         for (auto& enemy : enemies) {
-            enemy.draw(window);
-        }
-
-        // Dibujar explosiones
-        for (auto& explosion : explosions) {
-            explosion.draw(window);
+            enemy.draw(effects, enemyMeshes);
         }
+        batchParticles(effects, particles);
+        effects.flush(window);
 
         // Dibujar UI
         if (fontLoaded) {
@@ -1,26 +1,45 @@
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <vector>
-#include <cstdlib>
 #include <ctime>
 #include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <iostream>
 
-const int WINDOW_WIDTH = 1000;
-const int WINDOW_HEIGHT = 600;
-const int GROUND_HEIGHT = 50;
-const float GRAVITY = 0.4f;
-const float JUMP_STRENGTH = -15.0f;
-
-// Enumeraciones para menús y dificultad
-enum class GameDifficulty {
-    EASY,
-    NORMAL,
-    HARD
-};
+#include "AnimationClip.hpp"
+#include "AssetLoader.hpp"
+#include "DinoRevengeCore.hpp"
+#include "GameConfig.hpp"
+#include "Hud.hpp"
+#include "InputReplay.hpp"
+#include "Menus.hpp"
+#include "MusicPlaylist.hpp"
+#include "ParallaxBackground.hpp"
+#include "ParticleBatch.hpp"
+#include "PrimitiveBatch.hpp"
+#include "ProfilerOverlay.hpp"
+#include "ResourceCache.hpp"
+#include "SaveFile.hpp"
+#include "SoundEffects.hpp"
+#include "TextureAtlas.hpp"
+
+const unsigned RENDER_FRAMERATE_LIMIT = 144; // 0 = sin límite, el render interpola entre ticks
+const std::size_t SFX_VOICES = 8;          // Voces simultáneas de efectos
+const int SHOOT_MAX_VOICES = 2;            // Disparos que se superponen antes de cortar el más viejo
+const double TRACE_SECONDS = 10.0;         // Segundos que se guardan con F4 en la traza de Chrome
+const char* const REPLAY_PATH = "last_run.rpl"; // Repetición de la última partida jugada
+
+// Semilla nueva para cada partida
+std::uint64_t newRunSeed() {
+    return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+}
 
+// Enumeraciones para menús
 enum class MenuState {
     MAIN_MENU,
     DIFFICULTY_SELECT,
@@ -30,440 +49,140 @@ enum class MenuState {
     PLAYING
 };
 
-// Estructura para guardar récords con nombre de jugador
-struct HighScoreEntry {
-    std::string playerName;
-    int score;
-    std::string difficulty;
-    
-    HighScoreEntry() : playerName(""), score(0), difficulty("Normal") {}
-    HighScoreEntry(const std::string& name, int s, const std::string& diff) 
-        : playerName(name), score(s), difficulty(diff) {}
-};
-
-// Estructura de configuración global
-struct GameConfig {
-    float musicVolume = 50.0f;
-    float sfxVolume = 50.0f;
-    std::vector<HighScoreEntry> highScores;
-};
-
 // Estructura para almacenar información de personajes
 struct CharacterInfo {
     std::string name;
     std::string texturePath;
-    sf::Texture texture;
+    ResourceCache<sf::Texture>::Handle texture;
     int numFrames;
 };
 
-// Funciones para guardar y cargar configuración
-void saveConfig(const GameConfig& config) {
-    std::ofstream file("game_config.dat");
-    if (file.is_open()) {
-        file << config.musicVolume << "\n";
-        file << config.sfxVolume << "\n";
-        file << config.highScores.size() << "\n";
-        
-        for (const auto& entry : config.highScores) {
-            file << entry.playerName << "\n";
-            file << entry.score << "\n";
-            file << entry.difficulty << "\n";
-        }
-        file.close();
-    }
-}
-
-void loadConfig(GameConfig& config) {
-    std::ifstream file("game_config.dat");
-    if (file.is_open()) {
-        std::string line;
-        
-        // Leer volúmenes
-        std::getline(file, line);
-        config.musicVolume = std::stof(line);
-        std::getline(file, line);
-        config.sfxVolume = std::stof(line);
-        
-        // Leer número de scores
-        std::getline(file, line);
-        size_t numScores = std::stoi(line);
-        
-        config.highScores.clear();
-        for (size_t i = 0; i < numScores; ++i) {
-            HighScoreEntry entry;
-            std::getline(file, entry.playerName);
-            std::getline(file, line);
-            entry.score = std::stoi(line);
-            std::getline(file, entry.difficulty);
-            config.highScores.push_back(entry);
-        }
-        file.close();
-    }
-}
-
-// Función para agregar récord con nombre
-void addHighScore(GameConfig& config, const std::string& playerName, int score, GameDifficulty difficulty) {
-    std::string diffStr;
-    switch (difficulty) {
-        case GameDifficulty::EASY:
-            diffStr = "Facil";
-            break;
-        case GameDifficulty::NORMAL:
-            diffStr = "Normal";
-            break;
-        case GameDifficulty::HARD:
-            diffStr = "Dificil";
-            break;
-    }
-    
-    config.highScores.push_back(HighScoreEntry(playerName, score, diffStr));
-    
-    std::sort(config.highScores.begin(), config.highScores.end(),
-              [](const HighScoreEntry& a, const HighScoreEntry& b) {
-                  return a.score > b.score;
-              });
-    
-    if (config.highScores.size() > 10) {
-        config.highScores.resize(10);
-    }
-    
-    saveConfig(config);
-}
-
-class Projectile {
+// Dibuja el estado de DinoRevengeSimulation. Personaje y enemigos salen del
+// atlas como quads texturizados (un batch por página del atlas) y proyectiles
+// y partículas se acumulan en otro batch, así que un frame de combate cuesta
+// unas pocas llamadas de dibujo. Los rectángulos de cada frame se calculan
+// una vez en los clips; dibujar un sprite es buscar su frame en la tabla.
+class GameRenderer {
 public:
-    sf::CircleShape shape;
-    sf::CircleShape glow;
-    sf::Vector2f velocity;
-    bool active;
-    int direction;
-
-    Projectile(float x, float y, int dir) {
-        direction = dir;
-        shape.setRadius(6);
-        shape.setPosition(sf::Vector2f(x, y));
-        shape.setFillColor(sf::Color(255, 150, 0));
-        shape.setOutlineColor(sf::Color(255, 200, 0));
-        shape.setOutlineThickness(2);
-        
-        glow.setRadius(10);
-        glow.setPosition(sf::Vector2f(x - 4, y - 4));
-        glow.setFillColor(sf::Color(255, 100, 0, 100));
-        
-        velocity = sf::Vector2f(15.0f * direction, 0.0f);
-        active = true;
-    }
-
-    void update() {
-        shape.move(velocity);
-        glow.setPosition(sf::Vector2f(shape.getPosition().x - 4, shape.getPosition().y - 4));
-
-        if (shape.getPosition().x > WINDOW_WIDTH + 20 || 
-            shape.getPosition().x < -20 ||
-            shape.getPosition().y > WINDOW_HEIGHT) {
-            active = false;
+    GameRenderer(const TextureAtlas& atlas, AtlasHandle playerSheet, int playerFrames,
+                 const std::vector<AtlasHandle>& enemySheets, const EnemyPool& enemies)
+        : atlas(atlas), spriteLayers(atlas.getPageCount()) {
+        // Recortar sprite: usar 60% desde más abajo (eliminar 15% arriba, 25% abajo)
+        // y también los lados si hay espacio extra
+        ClipCrop playerCrop;
+        playerCrop.left = 0.1f;
+        playerCrop.top = 0.15f;
+        playerCrop.width = 0.8f;
+        playerCrop.height = 0.6f;
+        const AtlasRegion& playerRegion = atlas.getRegion(playerSheet);
+        playerClip = clips.add(makeAnimationClip(playerRegion.rect, playerFrames, PLAYER_FRAME_TIME,
+                                                 PLAYER_SCALE, playerCrop, playerRegion.page));
+
+        for (std::size_t type = 0; type < enemies.types.size(); ++type) {
+            const EnemyType& info = enemies.types[type];
+            const AtlasRegion& region = atlas.getRegion(enemySheets[type]);
+            enemyClips.push_back(clips.add(makeAnimationClip(region.rect, info.numFrames, ENEMY_FRAME_TIME,
+                                                             info.scale, ClipCrop(), region.page)));
         }
     }
 
-    void draw(sf::RenderWindow& window) {
-        if (active) {
-            window.draw(glow);
-            window.draw(shape);
+    // alpha: fracción del tick actual transcurrida, para interpolar las posiciones.
+    // Retorna las llamadas de dibujo hechas.
+    std::size_t draw(sf::RenderWindow& window, const DinoRevengeSimulation& sim, float alpha) {
+        std::size_t drawCalls = 0;
+        drawPlayer(sim.dino, alpha);
+        drawEnemies(sim.enemies, alpha);
+        for (std::size_t page = 0; page < spriteLayers.size(); ++page) {
+            drawCalls += spriteLayers[page].flush(window, sf::RenderStates(&atlas.getPage(page)));
         }
-    }
 
-    sf::FloatRect getBounds() const {
-        return shape.getGlobalBounds();
+        drawProjectiles(sim.projectiles, alpha);
+        batchParticles(effects, sim.particles, alpha);
+        drawCalls += effects.flush(window);
+        return drawCalls;
     }
-};
 
-class Dino {
-public:
-    sf::Texture* walkTexture;
-    sf::Sprite sprite;
-    float velocityY;
-    float x, y;
-    bool isJumping;
-    bool isDucking;
-    int animationFrame;
-    int facingDirection;
-    sf::Clock animationClock;
-    sf::Clock shootClock;
-    int numFrames;
-    float spriteScale;
-    float shootCooldownTime;
-
-    Dino(float startX, float startY, sf::Texture* texture, int frames, float cooldown = 0.25f) : sprite(*texture) {
-        walkTexture = texture;
-        x = startX;
-        y = startY;
-        facingDirection = 1;
-        numFrames = frames;
-        spriteScale = 0.6f;
-        shootCooldownTime = cooldown;
-        
-        sprite.setTexture(*walkTexture);
-        sprite.setScale(sf::Vector2f(spriteScale, spriteScale));
-        
-        sf::Vector2u texSize = walkTexture->getSize();
-        int frameWidth = texSize.x / numFrames;
-        
-        // Recortar sprite: usar 60% desde más abajo (eliminar 15% arriba, 25% abajo)
-        int visibleHeight = static_cast<int>(texSize.y * 0.6f);
-        int offsetY = static_cast<int>(texSize.y * 0.15f);
-        
-        // Recortar también los lados si hay espacio extra
-        int visibleWidth = static_cast<int>(frameWidth * 0.8f);
-        int offsetX = static_cast<int>(frameWidth * 0.1f);
-        
-        sprite.setTextureRect(sf::IntRect(sf::Vector2i(offsetX, offsetY), sf::Vector2i(visibleWidth, visibleHeight)));
-        
-        // Origen en la base de la parte visible
-        sprite.setOrigin(sf::Vector2f(visibleWidth / 2.0f, visibleHeight));
+private:
+    // Origen en la base de la parte visible, reflejado según la dirección
+    void drawPlayer(const Dino& dino, float alpha) {
+        const AnimationClip& clip = clips.get(playerClip);
+        float drawX = dino.previousX + (dino.x - dino.previousX) * alpha;
+        float drawY = dino.previousY + (dino.y - dino.previousY) * alpha;
 
-        velocityY = 0;
-        isJumping = false;
-        isDucking = false;
-        animationFrame = 0;
+        spriteLayers[clip.page].quad(sf::Vector2f(drawX - clip.drawSize.x / 2.0f, drawY - clip.drawSize.y), clip.drawSize,
+                                     clip.frames[dino.animationFrame], dino.facingDirection == -1);
     }
 
-    void jump() {
-        if (!isJumping && !isDucking) {
-            velocityY = JUMP_STRENGTH;
-            isJumping = true;
-        }
-    }
+    // Origen en la base del sprite para que todos los enemigos toquen el piso
+    void drawEnemies(const EnemyPool& enemies, float alpha) {
+        for (std::size_t i = 0; i < enemies.size(); ++i) {
+            const AnimationClip& clip = clips.get(enemyClips[enemies.type[i]]);
+            float drawX = enemies.previousX[i] + (enemies.x[i] - enemies.previousX[i]) * alpha;
 
-    void duck(bool shouldDuck) {
-        if (!isJumping) {
-            isDucking = shouldDuck;
+            spriteLayers[clip.page].quad(sf::Vector2f(drawX - clip.drawSize.x / 2.0f, enemies.y[i] - clip.drawSize.y),
+                                         clip.drawSize, clip.frames[enemies.currentFrame[i]]);
         }
     }
 
-    void moveLeft() {
-        x -= 8.0f;
-        if (x < 50) x = 50;
-        facingDirection = -1;
-    }
-
-    void moveRight() {
-        x += 8.0f;
-        if (x > WINDOW_WIDTH - 50) x = WINDOW_WIDTH - 50;
-        facingDirection = 1;
-    }
-
-    void update(float groundY, bool fastFall = false) {
-        if (isJumping) {
-            if (fastFall) {
-                velocityY += GRAVITY * 4.0f; // Caída más rápida al presionar abajo/S
-            } else {
-                velocityY += GRAVITY;
-            }
-            y += velocityY;
-
-            if (y >= groundY) {
-                y = groundY;
-                velocityY = 0;
-                isJumping = false;
-            }
+    // Brillo de radio 10 y bala de radio 6 con contorno de 2px, ambos centrados
+    // en (x + 6, y + 6) como las formas que se usaban antes
+    void drawProjectiles(const ProjectilePool& projectiles, float alpha) {
+        for (std::size_t i = 0; i < projectiles.size(); ++i) {
+            float drawX = projectiles.previousX[i] + (projectiles.x[i] - projectiles.previousX[i]) * alpha;
+            sf::Vector2f center(drawX + 6, projectiles.y[i] + 6);
+            effects.circle(center, 10, sf::Color(255, 100, 0, 100), 16);
+            effects.circle(center, 6, sf::Color(255, 150, 0), 16, 2, sf::Color(255, 200, 0));
         }
-
-        sprite.setTexture(*walkTexture);
-        sf::Vector2u texSize = walkTexture->getSize();
-        int frameWidth = texSize.x / numFrames;
-        
-        // Recortar sprite: usar 60% desde más abajo (eliminar 15% arriba, 25% abajo)
-        int visibleHeight = static_cast<int>(texSize.y * 0.6f);
-        int offsetY = static_cast<int>(texSize.y * 0.15f);
-        
-        // Recortar también los lados si hay espacio extra
-        int visibleWidth = static_cast<int>(frameWidth * 0.8f);
-        int offsetX = static_cast<int>(frameWidth * 0.1f);
-        
-        sprite.setOrigin(sf::Vector2f(visibleWidth / 2.0f, visibleHeight));
-        
-        if (animationClock.getElapsedTime().asSeconds() > 0.12f && !isJumping) {
-            animationFrame = (animationFrame + 1) % numFrames;
-            sprite.setTextureRect(sf::IntRect(sf::Vector2i(animationFrame * frameWidth + offsetX, offsetY), sf::Vector2i(visibleWidth, visibleHeight)));
-            animationClock.restart();
-        }
-        
-        // Aplicar escala según la dirección
-        if (facingDirection == -1) {
-            sprite.setScale(sf::Vector2f(-spriteScale, spriteScale));
-        } else {
-            sprite.setScale(sf::Vector2f(spriteScale, spriteScale));
-        }
-        
-        // IMPORTANTE: Actualizar posición del sprite con las coordenadas x, y
-        sprite.setPosition(sf::Vector2f(x, y));
     }
 
-    bool canShoot() {
-        return shootClock.getElapsedTime().asSeconds() > shootCooldownTime;
-    }
+    const TextureAtlas& atlas;
+    AnimationLibrary clips;
+    ClipId playerClip;
+    std::vector<ClipId> enemyClips;   // Índice = tipo de enemigo
 
-    void resetShootClock() {
-        shootClock.restart();
-    }
-
-    void draw(sf::RenderWindow& window) {
-        window.draw(sprite);
-    }
-
-    sf::FloatRect getBounds() const {
-        sf::FloatRect bounds = sprite.getGlobalBounds();
-        float newWidth = bounds.size.x * 0.6f;
-        float newHeight = bounds.size.y * 0.7f;
-        bounds.position.x += (bounds.size.x - newWidth) / 2.0f;
-        bounds.position.y += (bounds.size.y - newHeight) / 2.0f;
-        bounds.size.x = newWidth;
-        bounds.size.y = newHeight;
-        return bounds;
-    }
-
-    sf::Vector2f getShootPosition() const {
-        sf::FloatRect bounds = sprite.getGlobalBounds();
-        float shootY = y - (bounds.size.y * 0.5f);
-        float shootX = facingDirection == 1 ? x + (bounds.size.x * 0.4f) : x - (bounds.size.x * 0.4f);
-        return sf::Vector2f(shootX, shootY);
-    }
+    std::vector<PrimitiveBatch> spriteLayers;
+    PrimitiveBatch effects;
 };
 
-class Explosion {
-public:
-    std::vector<sf::CircleShape> particles;
-    std::vector<sf::Vector2f> velocities;
-    sf::Clock lifetime;
-    bool active;
-
-    Explosion(float x, float y) {
-        active = true;
-        int numParticles = 20;
-        
-        for (int i = 0; i < numParticles; ++i) {
-            sf::CircleShape particle(3);
-            particle.setFillColor(sf::Color(255, 100 + rand() % 156, 0));
-            particle.setPosition(sf::Vector2f(x, y));
-            particles.push_back(particle);
-            
-            float angle = (rand() % 360) * 3.14159f / 180.0f;
-            float speed = 2.0f + (rand() % 3);
-            velocities.push_back(sf::Vector2f(cos(angle) * speed, sin(angle) * speed));
-        }
-    }
-
-    void update() {
-        for (size_t i = 0; i < particles.size(); ++i) {
-            particles[i].move(velocities[i]);
-            velocities[i].y += 0.2f;
-        }
-
-        if (lifetime.getElapsedTime().asSeconds() > 0.5f) {
-            active = false;
-        }
-    }
-
-    void draw(sf::RenderWindow& window) {
-        if (active) {
-            for (auto& particle : particles) {
-                window.draw(particle);
-            }
-        }
-    }
+// Hojas y sonidos de disparo por personaje (0 = Pikachu con AK-47, 1 = Umbreon con ballesta)
+const char* const CHARACTER_SHEETS[2] = {"assets/images/PIKACHU (2) (1).png", "assets/images/Ballesta .png"};
+const char* const SHOOT_SOUNDS[2] = {"assets/music/AK-47.ogg", "assets/music/Ballesta sonido.ogg"};
+const char* const ENEMY_SHEETS[3] = {"assets/images/Gengar.png", "assets/images/Camioneta FINAL.png", "assets/images/Mewtwo (1).png"};
+
+// Assets de la partida. Se piden al arrancar para que se carguen en segundo
+// plano mientras el jugador recorre los menús.
+struct GameAssets {
+    AssetHandle<TextureAtlas> atlas;    // Ambos personajes y los tres enemigos
+    AssetHandle<sf::Texture> background;
+    AssetHandle<MusicPlaylist> gameMusic;   // Jugar1 y Jugar2 en bucle con crossfade
+    AssetHandle<sf::SoundBuffer> shootSounds[2];
 };
 
-class Enemy {
-public:
-    sf::Sprite sprite;
-    sf::Texture* texture;
-    float x, y;
-    float speed;
-    bool active;
-    int type;
-    int numFrames;
-    int currentFrame;
-    sf::Clock animClock;
-    float spriteScale;
-
-    Enemy(float startX, float groundY, sf::Texture* tex, int frames, int enemyType) : sprite(*tex) {
-        x = startX;
-        type = enemyType; // 0=Gengar, 1=Camioneta, 2=Mewtwo
-        active = true;
-        speed = 3.0f + (rand() % 3) * 0.5f;
-        texture = tex;
-        numFrames = frames;
-        currentFrame = 0;
-        
-        // Calcular escala y posición Y según el tipo de enemigo
-        sf::Vector2u texSize = texture->getSize();
-        float targetHeight;
-        
-        if (type == 0) { // Gengar - más grande y mucho más abajo
-            targetHeight = 180.0f;
-            y = 600.0f; // Posición Y mucho más abajo para confirmar cambio
-        } else if (type == 1) { // Camioneta - más abajo
-            targetHeight = 140.0f;
-            y = 595.0f; // Posición Y mucho más abajo para confirmar cambio
-        } else { // Mewtwo
-            targetHeight = 150.0f;
-            y = 590.0f; // Posición Y más abajo
-        }
-        
-        spriteScale = targetHeight / texSize.y;
-        
-        sprite.setTexture(*texture);
-        sprite.setScale(sf::Vector2f(spriteScale, spriteScale));
-        
-        int frameWidth = texSize.x / numFrames;
-        
-        sprite.setTextureRect(sf::IntRect(sf::Vector2i(0, 0), sf::Vector2i(frameWidth, texSize.y)));
-        
-        // Origen en la base del sprite para que todos toquen el piso
-        sprite.setOrigin(sf::Vector2f(frameWidth / 2.0f, texSize.y));
-        sprite.setPosition(sf::Vector2f(x, y));
-    }
-
-    void update(float speedMultiplier = 1.0f) {
-        x -= speed * speedMultiplier;
-        sprite.setPosition(sf::Vector2f(x, y));
-        
-        // Animar sprite
-        if (animClock.getElapsedTime().asSeconds() > 0.12f) {
-            currentFrame = (currentFrame + 1) % numFrames;
-            sf::Vector2u texSize = texture->getSize();
-            int frameWidth = texSize.x / numFrames;
-            sprite.setTextureRect(sf::IntRect(sf::Vector2i(currentFrame * frameWidth, 0), sf::Vector2i(frameWidth, texSize.y)));
-            animClock.restart();
-        }
-
-        if (x < -100) {
-            active = false;
-        }
-    }
-
-    void draw(sf::RenderWindow& window) {
-        if (active) {
-            window.draw(sprite);
-        }
-    }
-
-    sf::FloatRect getBounds() const {
-        return sprite.getGlobalBounds();
-    }
-};
+GameAssets requestGameAssets(AssetLoader& loader) {
+    GameAssets assets;
+    assets.atlas = loader.loadAtlas({CHARACTER_SHEETS[0], CHARACTER_SHEETS[1],
+                                     ENEMY_SHEETS[0], ENEMY_SHEETS[1], ENEMY_SHEETS[2]});
+    assets.background = loader.loadTexture("assets/images/fondo.png");
+    auto playlist = std::make_shared<MusicPlaylist>();
+    assets.gameMusic = loader.load(playlist, [playlist] {
+        return playlist->openFromFiles({"assets/music/Jugar1.ogg", "assets/music/Jugar2.ogg"});
+    });
+    assets.shootSounds[0] = loader.loadSoundBuffer(SHOOT_SOUNDS[0]);
+    assets.shootSounds[1] = loader.loadSoundBuffer(SHOOT_SOUNDS[1]);
+    return assets;
+}
 
 // Función para mostrar el menú principal
-MenuState showMainMenu(sf::RenderWindow& window, sf::Music& menuMusic, GameConfig& config) {
+MenuState showMainMenu(sf::RenderWindow& window, GameResources& resources, sf::Music& menuMusic, GameConfig& config) {
     // Cargar fondo del menú
-    sf::Texture backgroundTexture;
-    if (!backgroundTexture.loadFromFile("assets/images/Menu principal.png")) {
+    auto backgroundTexture = resources.textures.get("assets/images/Menu principal.png");
+    if (!backgroundTexture) {
         return MenuState::PLAYING; // Si falla, ir directo al juego
     }
-    sf::Sprite backgroundSprite(backgroundTexture);
+    sf::Sprite backgroundSprite(*backgroundTexture);
     
     // Escalar fondo
-    sf::Vector2u bgSize = backgroundTexture.getSize();
+    sf::Vector2u bgSize = backgroundTexture->getSize();
     float scaleX = static_cast<float>(WINDOW_WIDTH) / bgSize.x;
     float scaleY = static_cast<float>(WINDOW_HEIGHT) / bgSize.y;
     float scale = std::max(scaleX, scaleY);
@@ -474,13 +193,13 @@ MenuState showMainMenu(sf::RenderWindow& window, sf::Music& menuMusic, GameConfi
     ));
     
     // Cargar fuente
-    sf::Font font;
-    if (!font.openFromFile("assets/fonts/Minecraft.ttf")) {
+    auto font = resources.fonts.get("assets/fonts/Minecraft.ttf");
+    if (!font) {
         return MenuState::PLAYING;
     }
     
     // Título
-    sf::Text titleText(font);
+    sf::Text titleText(*font);
     titleText.setString("PockyMan: Asalto a la Pokeplaza");
     titleText.setCharacterSize(45);
     titleText.setFillColor(sf::Color::Yellow);
@@ -499,7 +218,7 @@ MenuState showMainMenu(sf::RenderWindow& window, sf::Music& menuMusic, GameConfi
     int selectedOption = 0;
     
     for (size_t i = 0; i < menuOptions.size(); ++i) {
-        sf::Text text(font);
+        sf::Text text(*font);
         text.setString(menuOptions[i]);
         text.setCharacterSize(35);
         text.setFillColor(sf::Color::White);
@@ -559,20 +278,21 @@ MenuState showMainMenu(sf::RenderWindow& window, sf::Music& menuMusic, GameConfi
             window.draw(text);
         }
         window.display();
+        resources.loader.update();
     }
     
     return MenuState::MAIN_MENU;
 }
 
 // Función para seleccionar dificultad
-GameDifficulty showDifficultySelect(sf::RenderWindow& window) {
+GameDifficulty showDifficultySelect(sf::RenderWindow& window, GameResources& resources) {
     // Cargar fondo
-    sf::Texture bgTexture;
-    bool hasBackground = bgTexture.loadFromFile("assets/images/Menu principal.png");
-    sf::Sprite bgSprite(bgTexture);
+    auto bgTexture = resources.textures.get("assets/images/Menu principal.png");
+    bool hasBackground = bgTexture != nullptr;
+    sf::Sprite bgSprite(hasBackground ? *bgTexture : resources.textures.placeholder());
     if (hasBackground) {
-        float scaleX = static_cast<float>(WINDOW_WIDTH) / bgTexture.getSize().x;
-        float scaleY = static_cast<float>(WINDOW_HEIGHT) / bgTexture.getSize().y;
+        float scaleX = static_cast<float>(WINDOW_WIDTH) / bgTexture->getSize().x;
+        float scaleY = static_cast<float>(WINDOW_HEIGHT) / bgTexture->getSize().y;
         bgSprite.setScale(sf::Vector2f(scaleX, scaleY));
     }
     
@@ -580,12 +300,12 @@ GameDifficulty showDifficultySelect(sf::RenderWindow& window) {
     sf::RectangleShape overlay(sf::Vector2f(WINDOW_WIDTH, WINDOW_HEIGHT));
     overlay.setFillColor(sf::Color(0, 0, 0, 150));
     
-    sf::Font font;
-    if (!font.openFromFile("assets/fonts/Minecraft.ttf")) {
+    auto font = resources.fonts.get("assets/fonts/Minecraft.ttf");
+    if (!font) {
         return GameDifficulty::NORMAL;
     }
     
-    sf::Text titleText(font);
+    sf::Text titleText(*font);
     titleText.setString("SELECCIONA LA DIFICULTAD");
     titleText.setCharacterSize(45);
     titleText.setFillColor(sf::Color::Yellow);
@@ -603,7 +323,7 @@ GameDifficulty showDifficultySelect(sf::RenderWindow& window) {
     int selectedDiff = 1; // Normal por defecto
     
     for (size_t i = 0; i < difficulties.size(); ++i) {
-        sf::Text text(font);
+        sf::Text text(*font);
         text.setString(difficulties[i]);
         text.setCharacterSize(26);
         text.setFillColor(sf::Color::White);
@@ -656,207 +376,12 @@ GameDifficulty showDifficultySelect(sf::RenderWindow& window) {
             window.draw(text);
         }
         window.display();
+        resources.loader.update();
     }
     
     return GameDifficulty::NORMAL;
 }
 
-// Función para mostrar configuraciones
-void showSettings(sf::RenderWindow& window, GameConfig& config) {
-    // Cargar fondo
-    sf::Texture bgTexture;
-    bool hasBackground = bgTexture.loadFromFile("assets/images/Menu principal.png");
-    sf::Sprite bgSprite(bgTexture);
-    if (hasBackground) {
-        float scaleX = static_cast<float>(WINDOW_WIDTH) / bgTexture.getSize().x;
-        float scaleY = static_cast<float>(WINDOW_HEIGHT) / bgTexture.getSize().y;
-        bgSprite.setScale(sf::Vector2f(scaleX, scaleY));
-    }
-    
-    // Overlay semitransparente
-    sf::RectangleShape overlay(sf::Vector2f(WINDOW_WIDTH, WINDOW_HEIGHT));
-    overlay.setFillColor(sf::Color(0, 0, 0, 150));
-    
-    sf::Font font;
-    if (!font.openFromFile("assets/fonts/Minecraft.ttf")) {
-        return;
-    }
-    
-    sf::Text titleText(font);
-    titleText.setString("CONFIGURACIONES");
-    titleText.setCharacterSize(45);
-    titleText.setFillColor(sf::Color::Yellow);
-    titleText.setOutlineColor(sf::Color::Black);
-    titleText.setOutlineThickness(3);
-    titleText.setPosition(sf::Vector2f(280, 80));
-    
-    sf::Text musicText(font);
-    musicText.setCharacterSize(30);
-    musicText.setFillColor(sf::Color::White);
-    musicText.setOutlineColor(sf::Color::Black);
-    musicText.setOutlineThickness(2);
-    musicText.setPosition(sf::Vector2f(200, 220));
-    
-    sf::Text sfxText(font);
-    sfxText.setCharacterSize(30);
-    sfxText.setFillColor(sf::Color::White);
-    sfxText.setOutlineColor(sf::Color::Black);
-    sfxText.setOutlineThickness(2);
-    sfxText.setPosition(sf::Vector2f(200, 300));
-    
-    sf::Text instructionText(font);
-    instructionText.setString("Usa Flechas para ajustar, ESC para salir");
-    instructionText.setCharacterSize(22);
-    instructionText.setFillColor(sf::Color::White);
-    instructionText.setOutlineColor(sf::Color::Black);
-    instructionText.setOutlineThickness(2);
-    instructionText.setPosition(sf::Vector2f(230, 480));
-    
-    int selectedSetting = 0; // 0 = música, 1 = sfx
-    
-    while (window.isOpen()) {
-        while (const auto event = window.pollEvent()) {
-            if (event->is<sf::Event::Closed>()) {
-                window.close();
-                return;
-            }
-            
-            if (const auto* keyPressed = event->getIf<sf::Event::KeyPressed>()) {
-                if (keyPressed->code == sf::Keyboard::Key::Escape) {
-                    saveConfig(config);
-                    return;
-                } else if (keyPressed->code == sf::Keyboard::Key::Up) {
-                    selectedSetting = 0;
-                } else if (keyPressed->code == sf::Keyboard::Key::Down) {
-                    selectedSetting = 1;
-                } else if (keyPressed->code == sf::Keyboard::Key::Left) {
-                    if (selectedSetting == 0) {
-                        config.musicVolume = std::max(0.0f, config.musicVolume - 5.0f);
-                    } else {
-                        config.sfxVolume = std::max(0.0f, config.sfxVolume - 5.0f);
-                    }
-                } else if (keyPressed->code == sf::Keyboard::Key::Right) {
-                    if (selectedSetting == 0) {
-                        config.musicVolume = std::min(100.0f, config.musicVolume + 5.0f);
-                    } else {
-                        config.sfxVolume = std::min(100.0f, config.sfxVolume + 5.0f);
-                    }
-                }
-            }
-        }
-        
-        musicText.setString("Volumen Musica: " + std::to_string(static_cast<int>(config.musicVolume)) + "%");
-        musicText.setFillColor(selectedSetting == 0 ? sf::Color::Yellow : sf::Color::White);
-        
-        sfxText.setString("Volumen Efectos: " + std::to_string(static_cast<int>(config.sfxVolume)) + "%");
-        sfxText.setFillColor(selectedSetting == 1 ? sf::Color::Yellow : sf::Color::White);
-        
-        window.clear(sf::Color(20, 20, 40));
-        if (hasBackground) {
-            window.draw(bgSprite);
-            window.draw(overlay);
-        }
-        window.draw(titleText);
-        window.draw(musicText);
-        window.draw(sfxText);
-        window.draw(instructionText);
-        window.display();
-    }
-}
-
-// Función para mostrar récords
-void showHighScores(sf::RenderWindow& window, const GameConfig& config) {
-    sf::Font font;
-    if (!font.openFromFile("assets/fonts/Minecraft.ttf")) {
-        return;
-    }
-    
-    // Cargar fondo
-    sf::Texture bgTexture;
-    bool hasBackground = bgTexture.loadFromFile("assets/images/Menu principal.png");
-    sf::Sprite bgSprite(bgTexture);
-    if (hasBackground) {
-        float scaleX = static_cast<float>(WINDOW_WIDTH) / bgTexture.getSize().x;
-        float scaleY = static_cast<float>(WINDOW_HEIGHT) / bgTexture.getSize().y;
-        bgSprite.setScale(sf::Vector2f(scaleX, scaleY));
-    }
-    
-    sf::Text titleText(font);
-    titleText.setString("REGISTRO DE RECORD - TOP 10");
-    titleText.setCharacterSize(40);
-    titleText.setFillColor(sf::Color::Yellow);
-    titleText.setPosition(sf::Vector2f(200, 50));
-    
-    std::vector<sf::Text> scoreTexts;
-    
-    // Mostrar siempre 10 lugares
-    for (size_t i = 0; i < 10; ++i) {
-        std::string scoreStr;
-        
-        if (i < config.highScores.size()) {
-            const auto& entry = config.highScores[i];
-            scoreStr = std::to_string(i + 1) + ". " + 
-                      entry.playerName + " - " + 
-                      std::to_string(entry.score) + " pts (" + 
-                      entry.difficulty + ")";
-        } else {
-            scoreStr = std::to_string(i + 1) + ". ---";
-        }
-        
-        sf::Text text(font);
-        text.setString(scoreStr);
-        text.setCharacterSize(22);
-        
-        if (i == 0) {
-            text.setFillColor(sf::Color(255, 215, 0));
-        } else if (i == 1) {
-            text.setFillColor(sf::Color(192, 192, 192));
-        } else if (i == 2) {
-            text.setFillColor(sf::Color(205, 127, 50));
-        } else {
-            text.setFillColor(sf::Color::White);
-        }
-        
-        text.setPosition(sf::Vector2f(120, 140 + i * 35));
-        scoreTexts.push_back(text);
-    }
-    
-    sf::Text backText(font);
-    backText.setString("Presiona ESC para volver");
-    backText.setCharacterSize(20);
-    backText.setFillColor(sf::Color(200, 200, 200));
-    backText.setPosition(sf::Vector2f(320, 540));
-    
-    while (window.isOpen()) {
-        while (const auto event = window.pollEvent()) {
-            if (event->is<sf::Event::Closed>()) {
-                window.close();
-                return;
-            }
-            
-            if (const auto* keyPressed = event->getIf<sf::Event::KeyPressed>()) {
-                if (keyPressed->code == sf::Keyboard::Key::Escape) {
-                    return;
-                }
-            }
-        }
-        
-        window.clear(sf::Color(20, 20, 40));
-        window.draw(bgSprite);
-        
-        sf::RectangleShape overlay(sf::Vector2f(WINDOW_WIDTH, WINDOW_HEIGHT));
-        overlay.setFillColor(sf::Color(0, 0, 0, 120));
-        window.draw(overlay);
-        
-        window.draw(titleText);
-        for (auto& text : scoreTexts) {
-            window.draw(text);
-        }
-        window.draw(backText);
-        window.display();
-    }
-}
-
 // Estructura para retornar opciones de game over
 struct GameOverResult {
     std::string playerName;
@@ -864,25 +389,25 @@ struct GameOverResult {
 };
 
 // Declaración anticipada
-GameOverResult showPostGameMenu(sf::RenderWindow& window, const std::string& playerName, int finalScore);
+GameOverResult showPostGameMenu(sf::RenderWindow& window, GameResources& resources, const std::string& playerName, int finalScore);
 
 // Pantalla de Game Over con input de nombre
-GameOverResult showGameOver(sf::RenderWindow& window, int finalScore, GameDifficulty difficulty) {
-    sf::Font font;
-    if (!font.openFromFile("assets/fonts/Minecraft.ttf")) {
+GameOverResult showGameOver(sf::RenderWindow& window, GameResources& resources, int finalScore, GameDifficulty difficulty) {
+    auto font = resources.fonts.get("assets/fonts/Minecraft.ttf");
+    if (!font) {
         return {"Player", -1};
     }
     
-    sf::Texture bgTexture;
-    bool hasBackground = bgTexture.loadFromFile("assets/images/Menu principal.png");
-    sf::Sprite bgSprite(bgTexture);
+    auto bgTexture = resources.textures.get("assets/images/Menu principal.png");
+    bool hasBackground = bgTexture != nullptr;
+    sf::Sprite bgSprite(hasBackground ? *bgTexture : resources.textures.placeholder());
     if (hasBackground) {
-        float scaleX = static_cast<float>(WINDOW_WIDTH) / bgTexture.getSize().x;
-        float scaleY = static_cast<float>(WINDOW_HEIGHT) / bgTexture.getSize().y;
+        float scaleX = static_cast<float>(WINDOW_WIDTH) / bgTexture->getSize().x;
+        float scaleY = static_cast<float>(WINDOW_HEIGHT) / bgTexture->getSize().y;
         bgSprite.setScale(sf::Vector2f(scaleX, scaleY));
     }
     
-    sf::Text titleText(font);
+    sf::Text titleText(*font);
     titleText.setString("GAME OVER");
     titleText.setCharacterSize(60);
     titleText.setFillColor(sf::Color::Red);
@@ -890,31 +415,31 @@ GameOverResult showGameOver(sf::RenderWindow& window, int finalScore, GameDiffic
     titleText.setOutlineThickness(3);
     titleText.setPosition(sf::Vector2f(320, 100));
     
-    sf::Text scoreText(font);
+    sf::Text scoreText(*font);
     scoreText.setString("Puntuacion Final: " + std::to_string(finalScore));
     scoreText.setCharacterSize(35);
     scoreText.setFillColor(sf::Color::Yellow);
     scoreText.setPosition(sf::Vector2f(250, 220));
     
-    sf::Text promptText(font);
+    sf::Text promptText(*font);
     promptText.setString("Ingresa tu nombre:");
     promptText.setCharacterSize(28);
     promptText.setFillColor(sf::Color::White);
     promptText.setPosition(sf::Vector2f(330, 300));
     
     std::string playerName = "";
-    sf::Text nameInputText(font);
+    sf::Text nameInputText(*font);
     nameInputText.setCharacterSize(30);
     nameInputText.setFillColor(sf::Color::Cyan);
     nameInputText.setPosition(sf::Vector2f(350, 350));
     
-    sf::Text instructionText(font);
+    sf::Text instructionText(*font);
     instructionText.setString("Escribe tu nombre y presiona ENTER (max 15 caracteres)");
     instructionText.setCharacterSize(18);
     instructionText.setFillColor(sf::Color(200, 200, 200));
     instructionText.setPosition(sf::Vector2f(180, 450));
     
-    sf::Text skipText(font);
+    sf::Text skipText(*font);
     skipText.setString("R: Reintentar | ESC: Menu");
     skipText.setCharacterSize(16);
     skipText.setFillColor(sf::Color(150, 150, 150));
@@ -970,29 +495,30 @@ GameOverResult showGameOver(sf::RenderWindow& window, int finalScore, GameDiffic
         window.draw(instructionText);
         window.draw(skipText);
         window.display();
+        resources.loader.update();
     }
     
     // Ahora mostrar opciones después de guardar
-    return showPostGameMenu(window, playerName.empty() ? "Anonimo" : playerName, finalScore);
+    return showPostGameMenu(window, resources, playerName.empty() ? "Anonimo" : playerName, finalScore);
 }
 
 // Menú después de registrar el nombre
-GameOverResult showPostGameMenu(sf::RenderWindow& window, const std::string& playerName, int finalScore) {
-    sf::Font font;
-    if (!font.openFromFile("assets/fonts/Minecraft.ttf")) {
+GameOverResult showPostGameMenu(sf::RenderWindow& window, GameResources& resources, const std::string& playerName, int finalScore) {
+    auto font = resources.fonts.get("assets/fonts/Minecraft.ttf");
+    if (!font) {
         return {playerName, 2};
     }
     
-    sf::Texture bgTexture;
-    bool hasBackground = bgTexture.loadFromFile("assets/images/Menu principal.png");
-    sf::Sprite bgSprite(bgTexture);
+    auto bgTexture = resources.textures.get("assets/images/Menu principal.png");
+    bool hasBackground = bgTexture != nullptr;
+    sf::Sprite bgSprite(hasBackground ? *bgTexture : resources.textures.placeholder());
     if (hasBackground) {
-        float scaleX = static_cast<float>(WINDOW_WIDTH) / bgTexture.getSize().x;
-        float scaleY = static_cast<float>(WINDOW_HEIGHT) / bgTexture.getSize().y;
+        float scaleX = static_cast<float>(WINDOW_WIDTH) / bgTexture->getSize().x;
+        float scaleY = static_cast<float>(WINDOW_HEIGHT) / bgTexture->getSize().y;
         bgSprite.setScale(sf::Vector2f(scaleX, scaleY));
     }
     
-    sf::Text titleText(font);
+    sf::Text titleText(*font);
     titleText.setString("RECORD GUARDADO!");
     titleText.setCharacterSize(50);
     titleText.setFillColor(sf::Color::Yellow);
@@ -1000,13 +526,13 @@ GameOverResult showPostGameMenu(sf::RenderWindow& window, const std::string& pla
     titleText.setOutlineThickness(3);
     titleText.setPosition(sf::Vector2f(250, 100));
     
-    sf::Text nameText(font);
+    sf::Text nameText(*font);
     nameText.setString("Jugador: " + playerName);
     nameText.setCharacterSize(30);
     nameText.setFillColor(sf::Color::White);
     nameText.setPosition(sf::Vector2f(350, 200));
     
-    sf::Text scoreText(font);
+    sf::Text scoreText(*font);
     scoreText.setString("Puntuacion: " + std::to_string(finalScore));
     scoreText.setCharacterSize(30);
     scoreText.setFillColor(sf::Color::Cyan);
@@ -1022,7 +548,7 @@ GameOverResult showPostGameMenu(sf::RenderWindow& window, const std::string& pla
     int selectedOption = 0;
     
     for (size_t i = 0; i < options.size(); ++i) {
-        sf::Text text(font);
+        sf::Text text(*font);
         text.setString(options[i]);
         text.setCharacterSize(28);
         text.setFillColor(i == 0 ? sf::Color::Cyan : sf::Color::White);
@@ -1030,7 +556,7 @@ GameOverResult showPostGameMenu(sf::RenderWindow& window, const std::string& pla
         optionTexts.push_back(text);
     }
     
-    sf::Text instructionText(font);
+    sf::Text instructionText(*font);
     instructionText.setString("Usa FLECHAS o numeros, ENTER para confirmar");
     instructionText.setCharacterSize(18);
     instructionText.setFillColor(sf::Color(200, 200, 200));
@@ -1092,27 +618,29 @@ GameOverResult showPostGameMenu(sf::RenderWindow& window, const std::string& pla
         }
         window.draw(instructionText);
         window.display();
+        resources.loader.update();
     }
     
     return {playerName, 2};
 }
 
 // Función para mostrar el menú de selección de personaje
-int showCharacterSelection(sf::RenderWindow& window) {
+int showCharacterSelection(sf::RenderWindow& window, GameResources& resources) {
     // La música del menú principal sigue sonando durante la selección de personaje
     
     // Cargar fondo principal
-    sf::Texture backgroundTexture;
-    if (!backgroundTexture.loadFromFile("assets/images/Fondo principal.png")) {
+    auto backgroundTexture = resources.textures.get("assets/images/Fondo principal.png");
+    if (!backgroundTexture) {
         // Si falla, intentar con el fondo del menú
-        if (!backgroundTexture.loadFromFile("assets/images/Menu principal.png")) {
+        backgroundTexture = resources.textures.get("assets/images/Menu principal.png");
+        if (!backgroundTexture) {
             return 0; // Error cargando fondo
         }
     }
-    sf::Sprite backgroundSprite(backgroundTexture);
+    sf::Sprite backgroundSprite(*backgroundTexture);
     
     // Escalar el fondo para que cubra toda la ventana
-    sf::Vector2u bgSize = backgroundTexture.getSize();
+    sf::Vector2u bgSize = backgroundTexture->getSize();
     float scaleX = static_cast<float>(WINDOW_WIDTH) / bgSize.x;
     float scaleY = static_cast<float>(WINDOW_HEIGHT) / bgSize.y;
     backgroundSprite.setScale(sf::Vector2f(scaleX, scaleY));
@@ -1122,23 +650,24 @@ int showCharacterSelection(sf::RenderWindow& window) {
     
     pika.name = "PIKA";
     pika.texturePath = "assets/images/PIKACHU (2) (1).png";
-    pika.numFrames = 4;
+    pika.numFrames = PLAYER_FRAME_COUNT;
     
     ballesta.name = "Umbreon";
     ballesta.texturePath = "assets/images/Ballesta .png";
-    ballesta.numFrames = 4;
+    ballesta.numFrames = PLAYER_FRAME_COUNT;
     
-    if (!pika.texture.loadFromFile(pika.texturePath) || 
-        !ballesta.texture.loadFromFile(ballesta.texturePath)) {
+    pika.texture = resources.textures.get(pika.texturePath);
+    ballesta.texture = resources.textures.get(ballesta.texturePath);
+    if (!pika.texture || !ballesta.texture) {
         return 0; // Error cargando texturas
     }
     
     // Configurar sprites de vista previa
-    sf::Sprite pikaSprite(pika.texture);
-    sf::Sprite ballestaSprite(ballesta.texture);
+    sf::Sprite pikaSprite(*pika.texture);
+    sf::Sprite ballestaSprite(*ballesta.texture);
     
     // Configurar escala y posición para Pika (izquierda)
-    sf::Vector2u pikaSize = pika.texture.getSize();
+    sf::Vector2u pikaSize = pika.texture->getSize();
     int pikaFrameWidth = pikaSize.x / pika.numFrames;
     pikaSprite.setTextureRect(sf::IntRect(sf::Vector2i(0, 0), sf::Vector2i(pikaFrameWidth, pikaSize.y)));
     float pikaScale = 200.0f / pikaSize.y; // Reducir tamaño a 200px
@@ -1146,7 +675,7 @@ int showCharacterSelection(sf::RenderWindow& window) {
     pikaSprite.setPosition(sf::Vector2f(150, 220));
     
     // Configurar escala y posición para Ballesta (derecha)
-    sf::Vector2u ballestaSize = ballesta.texture.getSize();
+    sf::Vector2u ballestaSize = ballesta.texture->getSize();
     int ballestaFrameWidth = ballestaSize.x / ballesta.numFrames;
     ballestaSprite.setTextureRect(sf::IntRect(sf::Vector2i(0, 0), sf::Vector2i(ballestaFrameWidth, ballestaSize.y)));
     float ballestaScale = 200.0f / ballestaSize.y; // Reducir tamaño a 200px
@@ -1154,13 +683,13 @@ int showCharacterSelection(sf::RenderWindow& window) {
     ballestaSprite.setPosition(sf::Vector2f(550, 220));
     
     // Cargar fuente
-    sf::Font font;
-    if (!font.openFromFile("assets/fonts/Minecraft.ttf")) {
+    auto font = resources.fonts.get("assets/fonts/Minecraft.ttf");
+    if (!font) {
         return 0;
     }
     
     // Textos
-    sf::Text titleText(font);
+    sf::Text titleText(*font);
     titleText.setString("SELECCIONA TU PERSONAJE");
     titleText.setCharacterSize(45);
     titleText.setFillColor(sf::Color::Yellow);
@@ -1168,7 +697,7 @@ int showCharacterSelection(sf::RenderWindow& window) {
     titleText.setOutlineThickness(3);
     titleText.setPosition(sf::Vector2f(180, 80));
     
-    sf::Text pikaText(font);
+    sf::Text pikaText(*font);
     pikaText.setString("PIKA");
     pikaText.setCharacterSize(30);
     pikaText.setFillColor(sf::Color::Yellow);
@@ -1176,7 +705,7 @@ int showCharacterSelection(sf::RenderWindow& window) {
     pikaText.setOutlineThickness(2);
     pikaText.setPosition(sf::Vector2f(180, 430));
     
-    sf::Text ballestaText(font);
+    sf::Text ballestaText(*font);
     ballestaText.setString("UMBREON");
     ballestaText.setCharacterSize(30);
     ballestaText.setFillColor(sf::Color::Yellow);
@@ -1184,7 +713,7 @@ int showCharacterSelection(sf::RenderWindow& window) {
     ballestaText.setOutlineThickness(2);
     ballestaText.setPosition(sf::Vector2f(550, 430));
     
-    sf::Text instructionText(font);
+    sf::Text instructionText(*font);
     instructionText.setString("Presiona 1 para PIKA o 2 para UMBREON | Flechas + Enter");
     instructionText.setCharacterSize(18);
     instructionText.setFillColor(sf::Color::White);
@@ -1272,20 +801,49 @@ int showCharacterSelection(sf::RenderWindow& window) {
         window.draw(instructionText);
         
         window.display();
+        resources.loader.update();
     }
     
     return selectedCharacter;
 }
 
-int main() {
-    srand(static_cast<unsigned>(time(0)));
+// Uso: 18_DinoRevengeSelect.exe [--replay archivo.rpl]
+// Con --replay se salta el menú, se reproduce la partida grabada y se
+// verifica que termine en el mismo estado.
+int main(int argc, char** argv) {
+    const char* replayPath = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replayPath = argv[++i];
+        }
+    }
+
+    InputReplay replay;
+    if (replayPath) {
+        std::vector<std::uint8_t> replayFile;
+        if (!readWholeFile(replayPath, replayFile) || replay.load(replayFile) != ReplayStatus::OK
+            || replay.getSetup().character >= 2) {
+            std::cout << "No se pudo cargar la repeticion " << replayPath << "\n";
+            return 1;
+        }
+    }
 
     // Cargar configuración
     GameConfig gameConfig;
     loadConfig(gameConfig);
 
     sf::RenderWindow window(sf::VideoMode({WINDOW_WIDTH, WINDOW_HEIGHT}), "PockyMan: Asalto a la Pokeplaza");
-    window.setFramerateLimit(60);
+    window.setFramerateLimit(RENDER_FRAMERATE_LIMIT);
+
+    // Texturas y fuentes se cargan una sola vez y se comparten entre pantallas
+    GameResources resources;
+    // Lo que usan todos los menús queda cargado toda la ejecución; el resto se
+    // libera al entrar al juego si ya nadie lo usa (releaseUnused)
+    auto menuFont = resources.fonts.get("assets/fonts/Minecraft.ttf");
+    auto menuBackground = resources.textures.get("assets/images/Menu principal.png");
+
+    // Los assets del juego se cargan en segundo plano mientras se muestran los menús
+    GameAssets gameAssets = requestGameAssets(resources.loader);
 
     // Cargar música del menú principal
     sf::Music menuMusic;
@@ -1301,12 +859,18 @@ int main() {
     int selectedCharacter = -1;
     bool shouldExit = false;
 
+    if (replayPath) {
+        difficulty = replay.getSetup().difficulty;
+        selectedCharacter = replay.getSetup().character;
+        currentState = MenuState::PLAYING;
+    }
+
     // Bucle principal del menú
 CONTINUE_MENU_LOOP:
     while (window.isOpen()) {
         switch (currentState) {
             case MenuState::MAIN_MENU: {
-                currentState = showMainMenu(window, menuMusic, gameConfig);
+                currentState = showMainMenu(window, resources, menuMusic, gameConfig);
                 if (!window.isOpen()) {
                     saveConfig(gameConfig);
                     return 0;
@@ -1315,7 +879,7 @@ CONTINUE_MENU_LOOP:
             }
             
             case MenuState::DIFFICULTY_SELECT: {
-                difficulty = showDifficultySelect(window);
+                difficulty = showDifficultySelect(window, resources);
                 if (!window.isOpen()) {
                     saveConfig(gameConfig);
                     return 0;
@@ -1326,7 +890,7 @@ CONTINUE_MENU_LOOP:
             }
             
             case MenuState::CHARACTER_SELECT: {
-                selectedCharacter = showCharacterSelection(window);
+                selectedCharacter = showCharacterSelection(window, resources);
                 if (selectedCharacter == -1 || !window.isOpen()) {
                     saveConfig(gameConfig);
                     return 0;
@@ -1337,7 +901,7 @@ CONTINUE_MENU_LOOP:
             }
             
             case MenuState::SETTINGS: {
-                showSettings(window, gameConfig);
+                showSettings(window, resources, gameConfig);
                 if (!window.isOpen()) {
                     saveConfig(gameConfig);
                     return 0;
@@ -1349,7 +913,7 @@ CONTINUE_MENU_LOOP:
             }
             
             case MenuState::HIGH_SCORES: {
-                showHighScores(window, gameConfig);
+                showHighScores(window, resources, gameConfig);
                 if (!window.isOpen()) {
                     saveConfig(gameConfig);
                     return 0;
@@ -1376,175 +940,137 @@ START_GAME:
         return 0; // Ventana cerrada durante la selección
     }
     
-    // Cargar textura del personaje seleccionado
-    sf::Texture characterTexture;
-    int numFrames = 4;
-    
-    if (selectedCharacter == 0) {
-        if (!characterTexture.loadFromFile("assets/images/PIKACHU (2) (1).png")) {
-            return -1;
-        }
-    } else {
-        if (!characterTexture.loadFromFile("assets/images/Ballesta .png")) {
-            return -1;
-        }
-    }
-    
-    // Cargar texturas de enemigos
-    sf::Texture gengarTexture, camionetaTexture, mewtwoTexture;
-    if (!gengarTexture.loadFromFile("assets/images/Gengar.png")) {
-        return -1;
-    }
-    if (!camionetaTexture.loadFromFile("assets/images/Camioneta FINAL.png")) {
-        return -1;
-    }
-    if (!mewtwoTexture.loadFromFile("assets/images/Mewtwo (1).png")) {
-        return -1;
-    }
-    
-    // Array de texturas de enemigos para selección aleatoria
-    sf::Texture* enemyTextures[] = {&gengarTexture, &camionetaTexture, &mewtwoTexture};
-    int enemyFrames[] = {4, 3, 4}; // Frames por cada enemigo
-
-    // Aplicar modificadores de dificultad
-    float difficultySpeedMultiplier = 1.0f;
-    float difficultyScoreMultiplier = 1.0f;
-    float shootCooldown = 0.25f; // Tiempo entre disparos
-    
-    switch (difficulty) {
-        case GameDifficulty::EASY:
-            difficultySpeedMultiplier = 0.7f; // 70% de velocidad
-            difficultyScoreMultiplier = 0.5f; // 50% de puntos
-            break;
-        case GameDifficulty::NORMAL:
-            difficultySpeedMultiplier = 1.0f; // 100% de velocidad
-            difficultyScoreMultiplier = 1.0f; // 100% de puntos
-            break;
-        case GameDifficulty::HARD:
-            difficultySpeedMultiplier = 1.4f; // 140% de velocidad
-            difficultyScoreMultiplier = 1.5f; // 150% de puntos
-            shootCooldown = 0.5f; // Doble cooldown en disparos
-            break;
-    }
+    // Los menús ya se cerraron: se libera lo que solo usaron ellos (fondo y
+    // sprites de la selección de personaje) o una partida anterior
+    resources.releaseUnused();
 
-    // Calcular posición del suelo - personajes tocan el borde del suelo
-    float groundY = WINDOW_HEIGHT - GROUND_HEIGHT;
-    
-    // Ajustar posición del personaje más abajo
-    float playerGroundY = groundY + 70;
-
-    // Crear personaje con la textura seleccionada
-    Dino dino(100, playerGroundY, &characterTexture, numFrames, shootCooldown);
+    // Desde acá hasta el primer frame de juego es la espera que ve el jugador
+    sf::Clock startupClock;
+    std::size_t pendingAssets = resources.loader.getPendingCount();
 
-    // Cargar fondo
-    sf::Texture backgroundTexture;
-    if (!backgroundTexture.loadFromFile("assets/images/fondo.png")) {
+    // Atlas con personajes y enemigos: todos los sprites del juego comparten
+    // textura y se dibujan juntos. Si todavía no terminó de cargarse, se completa ahora.
+    int numFrames = PLAYER_FRAME_COUNT;
+    auto atlas = resources.loader.finish(gameAssets.atlas);
+    if (!atlas) {
         return -1;
     }
-    sf::Sprite background1(backgroundTexture);
-    sf::Sprite background2(backgroundTexture);
+    AtlasHandle characterSheet = atlas->find(CHARACTER_SHEETS[selectedCharacter]);
+    AtlasHandle gengarSheet = atlas->find(ENEMY_SHEETS[0]);
+    AtlasHandle camionetaSheet = atlas->find(ENEMY_SHEETS[1]);
+    AtlasHandle mewtwoSheet = atlas->find(ENEMY_SHEETS[2]);
     
-    // Escalar el fondo para que abarque toda la altura de la ventana
-    sf::Vector2u bgSize = backgroundTexture.getSize();
-    float scaleY = static_cast<float>(WINDOW_HEIGHT) / bgSize.y;
-    float scaleX = scaleY; // Mantener proporción
-    background1.setScale(sf::Vector2f(scaleX, scaleY));
-    background2.setScale(sf::Vector2f(scaleX, scaleY));
-    
-    // Posicionar el segundo fondo para scroll continuo
-    background2.setPosition(sf::Vector2f(bgSize.x * scaleX, 0));
-    float backgroundSpeed = 2.0f;
-    float gameSpeedMultiplier = 1.0f * difficultySpeedMultiplier;
-
-    // Cargar músicas del juego
-    sf::Music gameMusic1, gameMusic2;
-    if (!gameMusic1.openFromFile("assets/music/Jugar1.ogg")) {
-        return -1;
-    }
-    if (!gameMusic2.openFromFile("assets/music/Jugar2.ogg")) {
+    // Cargar fondo
+    auto backgroundTexture = resources.loader.finish(gameAssets.background);
+    if (!backgroundTexture) {
         return -1;
     }
     
-    // Reproducir la primera música del juego
-    gameMusic1.setVolume(gameConfig.musicVolume);
-    gameMusic2.setVolume(gameConfig.musicVolume);
-    gameMusic1.play();
-    int currentMusic = 1; // 1 = Jugar1, 2 = Jugar2
-    
-    // Cargar sonidos de disparo según el personaje
-    sf::Music shootSound;
-    if (selectedCharacter == 0) {
-        // Pikachu usa AK-47
-        if (!shootSound.openFromFile("assets/music/AK-47.ogg")) {
-            return -1;
-        }
+    // Fondo: una capa que abarca toda la altura de la ventana (mantiene la
+    // proporción) sobre la textura repetida. Más capas de profundidad se
+    // agregan acá con una velocidad relativa menor.
+    ParallaxBackground background(WINDOW_WIDTH);
+    std::size_t mainLayer = background.addLayer(*backgroundTexture, 1.0f, 0, WINDOW_HEIGHT);
+    float scaledBgWidth = background.getTileWidth(mainLayer);
+
+    // Simulación: dificultad, tamaños de las hojas de sprites y semilla de la
+    // partida. En una repetición todo sale del archivo.
+    RunSetup setup;
+    if (replayPath) {
+        setup = replay.getSetup();
     } else {
-        // Umbreon usa Ballesta
-        if (!shootSound.openFromFile("assets/music/Ballesta sonido.ogg")) {
-            return -1;
+        setup.difficulty = difficulty;
+        setup.character = static_cast<std::uint8_t>(selectedCharacter);
+        setup.playerSheet = SheetSize{atlas->getSize(characterSheet).x, atlas->getSize(characterSheet).y};
+        setup.playerFrames = static_cast<std::uint8_t>(numFrames);
+        setup.enemySheets[0] = SheetSize{atlas->getSize(gengarSheet).x, atlas->getSize(gengarSheet).y};
+        setup.enemySheets[1] = SheetSize{atlas->getSize(camionetaSheet).x, atlas->getSize(camionetaSheet).y};
+        setup.enemySheets[2] = SheetSize{atlas->getSize(mewtwoSheet).x, atlas->getSize(mewtwoSheet).y};
+        setup.backgroundWidth = scaledBgWidth;
+        setup.seed = newRunSeed();
+    }
+    DinoRevengeSimulation sim;
+    sim.start(setup);
+
+    // Cada partida jugada se graba y se guarda en REPLAY_PATH al terminar o al salir
+    InputRecorder recorder;
+    if (!replayPath) {
+        recorder.begin(setup);
+    }
+    auto saveReplay = [&]() {
+        if (recorder.isRecording()) {
+            getSaveWriter().save(REPLAY_PATH, recorder.finish(sim));
         }
+    };
+
+    // Músicas del juego: la lista pasa de un tema al otro sola, en el hilo de audio
+    auto gameMusic = resources.loader.finish(gameAssets.gameMusic);
+    if (!gameMusic) {
+        return -1;
+    }
+    gameMusic->setVolume(gameConfig.musicVolume);
+    gameMusic->command(PlaylistCommand::RESTART);
+    
+    // Sonido de disparo según el personaje: cada disparo es una instancia del
+    // buffer ya decodificado, así que los disparos seguidos se escuchan por separado.
+    // AK-47.ogg es una ráfaga de ~2 s pensada para sonar en bucle: cada
+    // instancia se corta al tiempo entre disparos y no sigue sonando al soltar.
+    // La primera vez sale de la carga en segundo plano y pasa al caché de
+    // sonidos (se suelta el handle para que el caché pueda liberarlo); las
+    // partidas siguientes lo piden al caché.
+    const char* shootPath = SHOOT_SOUNDS[selectedCharacter];
+    auto shootBuffer = resources.sounds.adopt(shootPath, resources.loader.finish(gameAssets.shootSounds[selectedCharacter]));
+    gameAssets.shootSounds[selectedCharacter] = AssetHandle<sf::SoundBuffer>();
+    if (!shootBuffer) {
+        shootBuffer = resources.sounds.get(shootPath);
+    }
+    if (!shootBuffer) {
+        return -1;
     }
-    shootSound.setLooping(true); // Sonido en bucle mientras se dispara
-    shootSound.setVolume(gameConfig.sfxVolume);
-    bool isShooting = false;
+    SoundEffectPool<SFX_VOICES> soundEffects;
+    int shootEffect = soundEffects.addEffect(shootBuffer, 0, SHOOT_MAX_VOICES);
+    soundEffects.setMaxDuration(shootEffect, sf::seconds(sim.modifiers.shootCooldown));
+    soundEffects.setVolume(gameConfig.sfxVolume);
 
     // Suelo
     sf::RectangleShape ground(sf::Vector2f(WINDOW_WIDTH, GROUND_HEIGHT));
     ground.setPosition(sf::Vector2f(0, WINDOW_HEIGHT - GROUND_HEIGHT));
     ground.setFillColor(sf::Color(139, 90, 43));
 
-    std::vector<Enemy> enemies;
-    std::vector<Projectile> projectiles;
-    std::vector<Explosion> explosions;
+    GameRenderer renderer(*atlas, characterSheet, setup.playerFrames, {gengarSheet, camionetaSheet, mewtwoSheet}, sim.enemies);
 
-    sf::Clock enemySpawnClock;
-    float spawnInterval = 2.0f;
-    int lastEnemyType = -1; // -1=ninguno, 0=Gengar, 1=Camioneta, 2=Mewtwo
-    int consecutiveTrucks = 0; // Contador de camionetas consecutivas
+    int highScore = gameConfig.highScores[difficulty].best();
 
-    int score = 0;
-    int lives = 3;
-    int highScore = gameConfig.highScores.empty() ? 0 : gameConfig.highScores[0].score;
+    auto font = resources.fonts.get("assets/fonts/Minecraft.ttf");
+    if (!font) {
+        return -1;
+    }
 
-    sf::Font font;
-    if (!font.openFromFile("assets/fonts/Minecraft.ttf")) {
+    // HUD: las etiquetas y los dígitos se hornean una vez; cada frame solo se
+    // re-arma el campo cuyo número cambió
+    Hud hud;
+    int scoreField = hud.addField(sf::Vector2f(10, 10), 24, sf::Color::White, "Score: ");
+    int livesField = hud.addField(sf::Vector2f(10, 40), 24, sf::Color::Red, "Lives: ");
+    int highScoreField = hud.addField(sf::Vector2f(10, 70), 24, sf::Color::Yellow, "High Score: ");
+    // Campo de debug para mostrar posición X del personaje
+    int positionField = hud.addField(sf::Vector2f(10, 100), 20, sf::Color::Cyan, "X: ", " | Usa A/D o Flechas");
+    if (!hud.build(*font)) {
         return -1;
     }
+    hud.setValue(scoreField, 0);
+    hud.setValue(livesField, 3);
+    hud.setValue(highScoreField, highScore);
 
-    sf::Text scoreText(font);
-    scoreText.setString("Score: 0");
-    scoreText.setCharacterSize(24);
-    scoreText.setPosition(sf::Vector2f(10, 10));
-    scoreText.setFillColor(sf::Color::White);
-
-    sf::Text livesText(font);
-    livesText.setString("Lives: 3");
-    livesText.setCharacterSize(24);
-    livesText.setPosition(sf::Vector2f(10, 40));
-    livesText.setFillColor(sf::Color::Red);
-    
-    sf::Text highScoreText(font);
-    highScoreText.setString("High Score: " + std::to_string(highScore));
-    highScoreText.setCharacterSize(24);
-    highScoreText.setPosition(sf::Vector2f(10, 70));
-    highScoreText.setFillColor(sf::Color::Yellow);
-    
-    // Texto de debug para mostrar posición X del personaje
-    sf::Text debugText(font);
-    debugText.setCharacterSize(20);
-    debugText.setPosition(sf::Vector2f(10, 100));
-    debugText.setFillColor(sf::Color::Cyan);
-
-    bool gameOver = false;
     bool isPaused = false;
+    bool jumpRequested = false; // El salto llega como evento y se aplica en el siguiente tick
     
-    sf::Text gameOverText(font);
+    sf::Text gameOverText(*font);
     gameOverText.setString("GAME OVER - Presiona R para registrar tu record");
     gameOverText.setCharacterSize(26);
     gameOverText.setPosition(sf::Vector2f(150, WINDOW_HEIGHT / 2));
     gameOverText.setFillColor(sf::Color::Red);
     
-    sf::Text pauseText(font);
+    sf::Text pauseText(*font);
     pauseText.setString("PAUSA");
     pauseText.setCharacterSize(60);
     pauseText.setFillColor(sf::Color::Yellow);
@@ -1552,86 +1078,95 @@ START_GAME:
     pauseText.setOutlineThickness(3);
     pauseText.setPosition(sf::Vector2f(380, 200));
     
-    sf::Text pauseOptionsText(font);
+    sf::Text pauseOptionsText(*font);
     pauseOptionsText.setString("P o ESC: Continuar | M: Menu Principal");
     pauseOptionsText.setCharacterSize(22);
     pauseOptionsText.setFillColor(sf::Color::White);
     pauseOptionsText.setPosition(sf::Vector2f(220, 320));
 
+    // Profiler: F3 muestra el panel, F4 guarda los últimos segundos como traza de Chrome
+    FrameProfiler profiler;
+    sim.profiler = &profiler;
+    ProfilerOverlay profilerOverlay(*font, sf::Vector2f(WINDOW_WIDTH - 270, 10));
+
+    sf::Clock frameClock;
+    float accumulator = 0.0f;
+    bool firstFrame = true;
+
     while (window.isOpen()) {
+        float frameTime = std::min(frameClock.restart().asSeconds(), MAX_FRAME_TIME);
+        profiler.beginFrame();
+        std::int64_t inputStart = profiler.now();
+
         while (const auto event = window.pollEvent()) {
             if (event->is<sf::Event::Closed>()) {
                 window.close();
             }
 
             if (const auto* keyPressed = event->getIf<sf::Event::KeyPressed>()) {
+                if (keyPressed->code == sf::Keyboard::Key::F3) {
+                    profilerOverlay.toggle();
+                }
+                if (keyPressed->code == sf::Keyboard::Key::F4) {
+                    // Se arma en memoria y se escribe en segundo plano
+                    std::string json = profiler.exportChromeTrace(TRACE_SECONDS);
+                    std::string tracePath = "trace_" + std::to_string(std::time(nullptr)) + ".json";
+                    getSaveWriter().save(tracePath, std::vector<std::uint8_t>(json.begin(), json.end()));
+                    profilerOverlay.setStatus("Traza: " + tracePath);
+                    std::cout << "Traza guardada en " << tracePath << "\n";
+                }
+
                 // Pausa con P o ESC (solo si no está en game over)
-                if ((keyPressed->code == sf::Keyboard::Key::P || keyPressed->code == sf::Keyboard::Key::Escape) && !gameOver) {
+                if ((keyPressed->code == sf::Keyboard::Key::P || keyPressed->code == sf::Keyboard::Key::Escape) && !sim.gameOver) {
                     isPaused = !isPaused;
                     if (isPaused) {
                         // Pausar música
-                        if (currentMusic == 1) gameMusic1.pause();
-                        else gameMusic2.pause();
-                        if (isShooting) shootSound.pause();
+                        gameMusic->command(PlaylistCommand::PAUSE);
+                        soundEffects.pauseAll();
                     } else {
                         // Reanudar música
-                        if (currentMusic == 1) gameMusic1.play();
-                        else gameMusic2.play();
-                        if (isShooting) shootSound.play();
+                        gameMusic->command(PlaylistCommand::RESUME);
+                        soundEffects.resumeAll();
                     }
                 }
                 
                 // Volver al menú desde pausa
-                if (keyPressed->code == sf::Keyboard::Key::M && isPaused && !gameOver) {
-                    gameMusic1.stop();
-                    gameMusic2.stop();
-                    shootSound.stop();
-                    isShooting = false;
+                if (keyPressed->code == sf::Keyboard::Key::M && isPaused && !sim.gameOver) {
+                    gameMusic->command(PlaylistCommand::STOP);
+                    soundEffects.stopAll();
                     goto EXIT_GAME_LOOP;
                 }
                 
-                if (keyPressed->code == sf::Keyboard::Key::Space && !gameOver && !isPaused) {
-                    dino.jump();
+                if (keyPressed->code == sf::Keyboard::Key::Space && !sim.gameOver && !isPaused) {
+                    jumpRequested = true;
                 }
-                if (keyPressed->code == sf::Keyboard::Key::R && gameOver) {
+                if (keyPressed->code == sf::Keyboard::Key::R && sim.gameOver) {
                     // Pedir nombre del jugador y mostrar opciones
-                    GameOverResult result = showGameOver(window, score, difficulty);
+                    GameOverResult result = showGameOver(window, resources, sim.score, difficulty);
                     
                     // Guardar récord si ingresó nombre
                     if (!result.playerName.empty() && result.choice != -1) {
-                        addHighScore(gameConfig, result.playerName, score, difficulty);
+                        addHighScore(gameConfig, result.playerName, sim.score, difficulty);
                     }
                     
                     // Detener músicas y sonidos del juego
-                    gameMusic1.stop();
-                    gameMusic2.stop();
-                    shootSound.stop();
-                    isShooting = false;
+                    gameMusic->command(PlaylistCommand::STOP);
+                    soundEffects.stopAll();
                     
                     // Manejar la opción elegida
                     if (result.choice == 0) {
-                        // REINTENTAR - Reiniciar juego con mismo personaje y dificultad
-                        dino = Dino(100, playerGroundY, &characterTexture, numFrames, shootCooldown);
-                        enemies.clear();
-                        projectiles.clear();
-                        explosions.clear();
-                        score = 0;
-                        lives = 3;
-                        gameOver = false;
-                        enemySpawnClock.restart();
-                        lastEnemyType = -1;
-                        consecutiveTrucks = 0;
-                        spawnInterval = 2.0f;
+                        // REINTENTAR - Reiniciar juego con mismo personaje y dificultad (semilla nueva)
+                        setup.seed = newRunSeed();
+                        sim.start(setup);
+                        recorder.begin(setup);
+                        jumpRequested = false;
                         
                         // Reiniciar música del juego
-                        gameMusic1.stop();
-                        gameMusic2.stop();
-                        gameMusic1.play();
-                        currentMusic = 1;
+                        gameMusic->command(PlaylistCommand::RESTART);
                     }
                     else if (result.choice == 1) {
                         // VER RECORDS - Mostrar tabla de récords y volver al menú
-                        showHighScores(window, gameConfig);
+                        showHighScores(window, resources, gameConfig, difficulty);
                         // Salir del loop del juego para volver al menú
                         goto EXIT_GAME_LOOP;
                     }
@@ -1640,12 +1175,10 @@ START_GAME:
                         goto EXIT_GAME_LOOP;
                     }
                 }
-                if (keyPressed->code == sf::Keyboard::Key::Escape && gameOver) {
+                if (keyPressed->code == sf::Keyboard::Key::Escape && sim.gameOver) {
                     // Detener todas las músicas y sonidos del juego
-                    gameMusic1.stop();
-                    gameMusic2.stop();
-                    shootSound.stop();
-                    isShooting = false;
+                    gameMusic->command(PlaylistCommand::STOP);
+                    soundEffects.stopAll();
                     
                     // Volver al menú principal
                     goto EXIT_GAME_LOOP;
@@ -1653,210 +1186,100 @@ START_GAME:
             }
         }
         
-        // Alternar entre las músicas del juego cuando una termina (solo si no está en pausa)
-        if (!isPaused) {
-            if (currentMusic == 1 && gameMusic1.getStatus() != sf::Music::Status::Playing) {
-                gameMusic2.play();
-                currentMusic = 2;
-            } else if (currentMusic == 2 && gameMusic2.getStatus() != sf::Music::Status::Playing) {
-                gameMusic1.play();
-                currentMusic = 1;
-            }
+        profiler.record(ProfilePhase::INPUT, inputStart, profiler.now());
+
+        // Acumular tiempo real y simular en ticks fijos, independiente del render
+        if (!sim.gameOver && !isPaused) {
+            accumulator += frameTime;
+        } else {
+            accumulator = 0.0f;
         }
 
-        if (!gameOver && !isPaused) {
+        if (!sim.gameOver && !isPaused) {
+            std::int64_t sampleStart = profiler.now();
+            TickInput input;
+
             // Controles de movimiento horizontal (A/D o Flechas Izquierda/Derecha)
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Left) || sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A)) {
-                dino.moveLeft();
-            }
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Right) || sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D)) {
-                dino.moveRight();
-            }
-            
-            // Control de agacharse y caída rápida
-            bool isDuckingPressed = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Down) || sf::Keyboard::isKeyPressed(sf::Keyboard::Key::S);
-            dino.duck(isDuckingPressed);
-            
-            // Control de disparo con tecla R o clic izquierdo del ratón
-            bool shootKeyPressed = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::R) || 
-                                   sf::Mouse::isButtonPressed(sf::Mouse::Button::Left);
-            
-            if (shootKeyPressed) {
-                // Reproducir sonido de disparo en bucle mientras se dispara
-                if (!isShooting) {
-                    shootSound.play();
-                    isShooting = true;
-                }
-                
-                // Disparar proyectiles
-                if (dino.canShoot()) {
-                    sf::Vector2f shootPos = dino.getShootPosition();
-                    projectiles.push_back(Projectile(shootPos.x, shootPos.y, dino.facingDirection));
-                    dino.resetShootClock();
-                }
-            } else {
-                // Detener sonido cuando se suelta la tecla
-                if (isShooting) {
-                    shootSound.stop();
-                    isShooting = false;
-                }
-            }
+            input.left = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Left) || sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A);
+            input.right = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Right) || sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D);
 
-            // Actualizar personaje con su posición de suelo ajustada y caída rápida si presiona abajo/S
-            dino.update(playerGroundY, isDuckingPressed);
-            
-            // Aumentar velocidad del juego con el tiempo (cada 20 puntos)
-            // La velocidad aumenta gradualmente pero respeta el multiplicador base de dificultad
-            float progressMultiplier = 1.0f + (score / 100.0f);
-            if (progressMultiplier > 2.0f) progressMultiplier = 2.0f; // Límite máximo de 2x
-            gameSpeedMultiplier = difficultySpeedMultiplier * progressMultiplier;
-
-            // Mover fondo con velocidad aumentada
-            background1.move(sf::Vector2f(-backgroundSpeed * gameSpeedMultiplier, 0));
-            background2.move(sf::Vector2f(-backgroundSpeed * gameSpeedMultiplier, 0));
-            
-            // Usar el ancho escalado del fondo para el scroll
-            float scaledBgWidth = backgroundTexture.getSize().x * background1.getScale().x;
-            if (background1.getPosition().x <= -scaledBgWidth) {
-                background1.setPosition(sf::Vector2f(background2.getPosition().x + scaledBgWidth, 0));
-            }
-            if (background2.getPosition().x <= -scaledBgWidth) {
-                background2.setPosition(sf::Vector2f(background1.getPosition().x + scaledBgWidth, 0));
-            }
+            // Control de agacharse y caída rápida
+            input.duck = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Down) || sf::Keyboard::isKeyPressed(sf::Keyboard::Key::S);
 
-            // Spawn enemigos - seleccionar aleatoriamente entre Gengar, Camioneta y Mewtwo
-            float currentSpawnInterval = spawnInterval;
-            
-            // Si el último enemigo fue una camioneta, usar intervalo más largo
-            if (lastEnemyType == 1) {
-                currentSpawnInterval = std::max(3.5f, spawnInterval * 1.8f); // Mínimo 3.5 segundos después de una camioneta
-            }
-            
-            if (enemySpawnClock.getElapsedTime().asSeconds() > (currentSpawnInterval / gameSpeedMultiplier)) {
-                int randomEnemy = rand() % 3; // 0=Gengar, 1=Camioneta, 2=Mewtwo
-                
-                // Si el último enemigo fue una camioneta, evitar generar otra camioneta
-                // (75% de probabilidad de evitarla, 25% de permitirla)
-                if (lastEnemyType == 1 && randomEnemy == 1 && (rand() % 100) < 75) {
-                    randomEnemy = (rand() % 2 == 0) ? 0 : 2; // Gengar o Mewtwo en su lugar
-                }
-                
-                // Limitar camionetas consecutivas a máximo 1
-                if (randomEnemy == 1 && consecutiveTrucks >= 1) {
-                    randomEnemy = (rand() % 2 == 0) ? 0 : 2; // Forzar Gengar o Mewtwo
-                }
-                
-                enemies.push_back(Enemy(WINDOW_WIDTH, groundY, enemyTextures[randomEnemy], enemyFrames[randomEnemy], randomEnemy));
-                enemySpawnClock.restart();
-                
-                // Actualizar contador de camionetas consecutivas
-                if (randomEnemy == 1) {
-                    consecutiveTrucks++;
-                } else {
-                    consecutiveTrucks = 0;
-                }
-                
-                lastEnemyType = randomEnemy;
-                
-                if (score > 0 && score % 10 == 0 && spawnInterval > 1.2f) {
-                    spawnInterval -= 0.05f; // Reducción más gradual, mínimo 1.2s
+            // Control de disparo con tecla R o clic izquierdo del ratón
+            input.shoot = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::R) ||
+                          sf::Mouse::isButtonPressed(sf::Mouse::Button::Left);
+            profiler.record(ProfilePhase::INPUT, sampleStart, profiler.now());
+
+            while (accumulator >= FIXED_TIMESTEP && !sim.gameOver) {
+                accumulator -= FIXED_TIMESTEP;
+
+                input.jump = jumpRequested;
+                jumpRequested = false;
+                if (replayPath) {
+                    if (replay.atEnd()) {
+                        break;
+                    }
+                    input = replay.next();
                 }
+                recorder.record(input);
+                sim.tick(input);
             }
 
-            // Actualizar enemigos con velocidad aumentada
-            for (auto& enemy : enemies) {
-                enemy.update(gameSpeedMultiplier);
+            if (sim.gameOver) {
+                saveReplay();
             }
 
-            // Actualizar proyectiles
-            for (auto& projectile : projectiles) {
-                projectile.update();
+            // Fin de la repetición: el estado final tiene que coincidir con el grabado
+            if (replayPath && (replay.atEnd() || sim.gameOver)) {
+                bool matches = replay.atEnd() && sim.checksum() == replay.getExpectedChecksum()
+                               && sim.score == replay.getExpectedScore();
+                std::cout << "Repeticion " << (matches ? "correcta" : "DESINCRONIZADA") << ": score " << sim.score
+                          << " (grabado " << replay.getExpectedScore() << "), " << sim.tickCount << " ticks\n";
+                window.close();
             }
 
-            // Actualizar explosiones
-            for (auto& explosion : explosions) {
-                explosion.update();
+            // Un sonido por los disparos de los ticks de este frame
+            if (sim.shotsFired > 0) {
+                soundEffects.trigger(shootEffect);
+                sim.shotsFired = 0;
             }
 
-            // Colisiones proyectiles-enemigos
-            for (auto& projectile : projectiles) {
-                for (auto& enemy : enemies) {
-                    if (projectile.active && enemy.active && 
-                        projectile.getBounds().findIntersection(enemy.getBounds()).has_value()) {
-                        // La camioneta (tipo 1) es inmune a las balas - las balas la traspasan
-                        if (enemy.type == 1) {
-                            continue; // La bala no se destruye y la camioneta no recibe daño
-                        }
-                        projectile.active = false;
-                        enemy.active = false;
-                        score += static_cast<int>(10 * difficultyScoreMultiplier);
-                        explosions.push_back(Explosion(enemy.x, enemy.y - 25));
-                    }
-                }
-            }
+            // Actualizar HUD (los campos que no cambiaron no se tocan)
+            hud.setValue(scoreField, sim.score);
+            hud.setValue(livesField, sim.lives);
+            hud.setValue(positionField, static_cast<int>(sim.dino.x));
 
-            // Colisiones dino-enemigos
-            for (auto& enemy : enemies) {
-                if (enemy.active && dino.getBounds().findIntersection(enemy.getBounds()).has_value()) {
-                    enemy.active = false;
-                    lives--;
-                    if (lives <= 0) {
-                        gameOver = true;
-                        // Detener sonido de disparo al morir
-                        shootSound.stop();
-                        isShooting = false;
-                    }
-                }
-            }
-
-            // Limpiar objetos inactivos
-            enemies.erase(std::remove_if(enemies.begin(), enemies.end(),
-                [](const Enemy& e) { return !e.active; }), enemies.end());
-            projectiles.erase(std::remove_if(projectiles.begin(), projectiles.end(),
-                [](const Projectile& p) { return !p.active; }), projectiles.end());
-            explosions.erase(std::remove_if(explosions.begin(), explosions.end(),
-                [](const Explosion& e) { return !e.active; }), explosions.end());
-
-            // Actualizar textos
-            scoreText.setString("Score: " + std::to_string(score));
-            livesText.setString("Lives: " + std::to_string(lives));
-            debugText.setString("X: " + std::to_string(static_cast<int>(dino.x)) + " | Usa A/D o Flechas");
-            
             // Actualizar high score si se supera
-            if (score > highScore) {
-                highScore = score;
-                highScoreText.setString("High Score: " + std::to_string(highScore));
+            if (sim.score > highScore) {
+                highScore = sim.score;
+                hud.setValue(highScoreField, highScore);
             }
         }
 
-        // Dibujar
+        soundEffects.update();
+
+        // Dibujar interpolando entre el tick anterior y el actual
+        float alpha = (!sim.gameOver && !isPaused) ? accumulator / FIXED_TIMESTEP : 1.0f;
+        float drawBackgroundX = sim.previousBackgroundX + (sim.backgroundX - sim.previousBackgroundX) * alpha;
+        background.setScroll(-drawBackgroundX);
+
+        std::int64_t drawStart = profiler.now();
+        std::size_t drawCalls = 0;
         window.clear(sf::Color(135, 206, 235));
         
-        window.draw(background1);
-        window.draw(background2);
+        drawCalls += background.draw(window);
         window.draw(ground);
+        ++drawCalls;
         
-        dino.draw(window);
+        drawCalls += renderer.draw(window, sim, alpha);
         
-        for (auto& enemy : enemies) {
-            enemy.draw(window);
-        }
+        hud.draw(window);
+        ++drawCalls;
         
-        for (auto& projectile : projectiles) {
-            projectile.draw(window);
-        }
-        
-        for (auto& explosion : explosions) {
-            explosion.draw(window);
-        }
-        
-        window.draw(scoreText);
-        window.draw(livesText);
-        window.draw(highScoreText);
-        window.draw(debugText);
-        
-        if (gameOver) {
+        if (sim.gameOver) {
             window.draw(gameOverText);
+            ++drawCalls;
         }
         
         if (isPaused) {
@@ -1867,12 +1290,26 @@ START_GAME:
             
             window.draw(pauseText);
             window.draw(pauseOptionsText);
+            drawCalls += 3;
         }
         
+        drawCalls += profilerOverlay.draw(window, profiler);
+        profiler.record(ProfilePhase::DRAW, drawStart, profiler.now());
+        
         window.display();
+        profiler.endFrame(drawCalls, sim.entityCount() + 1); // + 1: el personaje
+
+        if (firstFrame) {
+            firstFrame = false;
+            std::cout << "Primer frame de juego: " << startupClock.getElapsedTime().asMilliseconds()
+                      << " ms (" << pendingAssets << " assets sin terminar al elegir personaje)\n";
+        }
     }
 
 EXIT_GAME_LOOP:
+    saveReplay(); // Partida sin terminar (volvió al menú o cerró la ventana)
+    resources.printStats(std::cout);
+
     // Reiniciar la música del menú al volver
     if (window.isOpen()) {
         menuMusic.play();